@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,11 @@ struct ClientConfig {
 // Session State (Opaque Handle)
 // ============================================================================
 
+// UDP side-channel and delta snapshot state (defined in ClientCore_Zone.cpp)
+struct ZoneUdpChannel;
+struct ZoneSnapshotBaselines;
+struct ZoneMessage;
+
 /**
  * ClientSession
  * 
@@ -52,9 +58,25 @@ struct ClientSession {
     std::uint16_t zonePort{ 0 };
     std::uint64_t selectedCharacterId{ 0 };
     
+    // Zone capabilities: requested = what we offer at ZoneAuth, negotiated = what the server accepted
+    std::uint32_t requestedZoneCapabilities{ req::shared::protocol::SupportedZoneCapabilities };
+    std::uint32_t zoneCapabilities{ 0 };
+    req::shared::protocol::QuantizationParams zoneQuantization;  // Zone's params (only with QuantizedState)
+    
     // Persistent zone connection (managed by connectToZone/disconnectFromZone)
     std::shared_ptr<boost::asio::io_context> zoneIoContext;
     std::shared_ptr<boost::asio::ip::tcp::socket> zoneSocket;
+    
+    // Entries of a received MessageBundle not yet returned by tryReceiveZoneMessage
+    std::shared_ptr<std::deque<ZoneMessage>> zonePendingMessages;
+    
+    // Reconstructed snapshots used as delta baselines (ZoneCapability::DeltaSnapshots)
+    std::shared_ptr<ZoneSnapshotBaselines> zoneSnapshotBaselines;
+    
+    // UDP side-channel (only when zoneCapabilities includes UdpChannel)
+    std::uint16_t zoneUdpPort{ 0 };
+    float udpSimulatedLossPercent{ 0.0f };  // Testing only: drop this % of datagrams in each direction
+    std::shared_ptr<ZoneUdpChannel> zoneUdp;
 };
 
 // ============================================================================
@@ -200,6 +222,7 @@ struct ZoneAuthResponse {
     ZoneAuthResult result;
     std::string errorMessage;
     std::string welcomeMessage;  // If success
+    std::uint32_t capabilities{ 0 };  // Negotiated ZoneCapability bits (if success)
 };
 
 /**
@@ -225,6 +248,7 @@ ZoneAuthResponse connectToZone(ClientSession& session);
  * 
  * Sends a MovementIntent message to the zone server.
  * Non-blocking - returns immediately.
+ * Goes over the UDP side-channel while it is active, otherwise over TCP.
  * 
  * @param session Current session (must have active zone connection)
  * @param inputX Movement input X axis (-1.0 to 1.0)
@@ -300,11 +324,45 @@ struct ZoneMessage {
  * @return true if message received, false if no messages available
  * 
  * Usage: Call this in your main loop to poll for zone messages.
+ *        Also services the UDP side-channel (Hello/keepalive, timeouts), so
+ *        datagram-delivered snapshots arrive through the same call.
+ *        MessageBundle frames are unpacked here; their entries are returned
+ *        one per call, in order, before anything else is read.
+ *        Zone Ping messages are answered with a Pong here and not returned,
+ *        so poll regularly to keep the server's RTT estimate current.
+ *        PlayerStateDelta messages are applied to their baseline here and
+ *        returned as complete PlayerStateSnapshot messages; the newest one is
+ *        acknowledged with the next sendMovementIntent.
+ *        Quantized PlayerStateSnapshot/EntityUpdate payloads (QuantizedState)
+ *        are decoded with the session's params and returned in the plain
+ *        binary encoding, so the parse helpers below need no params.
  */
 bool tryReceiveZoneMessage(
     const ClientSession& session,
     ZoneMessage& outMessage);
 
+/**
+ * ZoneUdpStats
+ * 
+ * Counters for the UDP side-channel of the current zone session.
+ */
+struct ZoneUdpStats {
+    bool active{ false };                   // Bound and heard from recently (UDP in use)
+    std::uint64_t datagramsSent{ 0 };
+    std::uint64_t datagramsReceived{ 0 };   // Accepted messages/acks
+    std::uint64_t datagramsStale{ 0 };      // Dropped: older than the newest accepted
+    std::uint64_t simulatedLossDrops{ 0 };  // Dropped by udpSimulatedLossPercent
+    std::uint64_t tcpFallbackSends{ 0 };    // MovementIntents sent over TCP while UDP was negotiated but inactive
+};
+
+/**
+ * getZoneUdpStats
+ * 
+ * @param session Current session
+ * @return Side-channel counters (all zero if UDP was not negotiated)
+ */
+ZoneUdpStats getZoneUdpStats(const ClientSession& session);
+
 // ============================================================================
 // Helper: Parse Common Zone Messages
 // ============================================================================
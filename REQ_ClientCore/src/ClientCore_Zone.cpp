@@ -1,15 +1,56 @@
 #include "req/clientcore/ClientCore.h"
 
+#include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstring>
+#include <random>
 #include <boost/asio.hpp>
 
 #include "../../../REQ_Shared/include/req/shared/MessageHeader.h"
+#include "../../../REQ_Shared/include/req/shared/MessageBundle.h"
 #include "../../../REQ_Shared/include/req/shared/MessageTypes.h"
 #include "../../../REQ_Shared/include/req/shared/Logger.h"
 
 namespace req::clientcore {
 
+// ============================================================================
+// UDP Side-Channel State
+// ============================================================================
+
+struct ZoneUdpChannel {
+    explicit ZoneUdpChannel(boost::asio::io_context& io)
+        : socket(io) {}
+    
+    boost::asio::ip::udp::socket socket;
+    boost::asio::ip::udp::endpoint serverEndpoint;
+    std::uint64_t characterId{ 0 };
+    std::uint64_t sessionKey{ 0 };  // Handoff token used for ZoneAuth
+    
+    std::uint32_t sendSequence{ 0 };
+    std::uint32_t lastReceiveSequence{ 0 };
+    bool hasReceivedMessage{ false };
+    bool bound{ false };  // HelloAck received and server heard from within the timeout
+    std::chrono::steady_clock::time_point lastReceive{};
+    std::chrono::steady_clock::time_point lastHelloSent{};
+    
+    float simulatedLossPercent{ 0.0f };
+    std::mt19937 lossRng{ std::random_device{}() };
+    ZoneUdpStats stats{};
+    std::array<char, 2048> receiveBuffer{};
+};
+
+// ============================================================================
+// Delta Snapshot State
+// ============================================================================
+
+struct ZoneSnapshotBaselines {
+    // Reconstructed states (sorted by characterId), oldest first
+    std::deque<std::pair<std::uint64_t, std::vector<req::shared::protocol::PlayerStateEntry>>> received;
+    std::uint64_t ackSnapshotId{ 0 };   // Sent in MovementIntent
+    std::uint64_t deltasDropped{ 0 };   // Baseline no longer held
+};
+
 namespace {
     using Tcp = boost::asio::ip::tcp;
     using ByteArray = std::vector<std::uint8_t>;
@@ -67,6 +108,152 @@ namespace {
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - g_startTime);
         return static_cast<std::uint32_t>(duration.count());
     }
+    
+    // ------------------------------------------------------------------------
+    // UDP side-channel helpers (see "UDP Side-Channel" in Protocol_Zone.h)
+    // ------------------------------------------------------------------------
+    
+    constexpr auto UdpKeepaliveInterval = std::chrono::milliseconds(req::shared::protocol::DatagramKeepaliveIntervalMs);
+    constexpr auto UdpBindRetryInterval = UdpKeepaliveInterval / 4;  // Hello cadence until bound
+    constexpr auto UdpSessionTimeout = 3 * UdpKeepaliveInterval;
+    
+    // Reconstructed snapshots kept as delta baselines; normally only the few
+    // since the last ack the server saw, this only caps a stalled server
+    constexpr std::size_t MaxHeldSnapshotBaselines = 64;
+    
+    bool udpDropForSimulatedLoss(ZoneUdpChannel& udp) {
+        if (udp.simulatedLossPercent <= 0.0f) {
+            return false;
+        }
+        std::uniform_real_distribution<float> dist(0.0f, 100.0f);
+        if (dist(udp.lossRng) < udp.simulatedLossPercent) {
+            ++udp.stats.simulatedLossDrops;
+            return true;
+        }
+        return false;
+    }
+    
+    void udpSend(ZoneUdpChannel& udp, req::shared::protocol::DatagramKind kind, std::string_view frame = {}) {
+        req::shared::protocol::DatagramHeader header;
+        header.kind = kind;
+        header.characterId = udp.characterId;
+        header.sessionKey = udp.sessionKey;
+        header.sequence = ++udp.sendSequence;
+        
+        if (udpDropForSimulatedLoss(udp)) {
+            return;
+        }
+        
+        std::string datagram = req::shared::protocol::buildDatagram(header, frame);
+        boost::system::error_code ec;
+        udp.socket.send_to(boost::asio::buffer(datagram), udp.serverEndpoint, 0, ec);
+        if (!ec) {
+            ++udp.stats.datagramsSent;
+        }
+    }
+    
+    // Keepalive and timeout handling; called from every send/receive poll
+    void udpService(ZoneUdpChannel& udp) {
+        auto now = std::chrono::steady_clock::now();
+        if (now - udp.lastHelloSent >= (udp.bound ? UdpKeepaliveInterval : UdpBindRetryInterval)) {
+            udp.lastHelloSent = now;
+            udpSend(udp, req::shared::protocol::DatagramKind::Hello);
+        }
+        if (udp.bound && now - udp.lastReceive > UdpSessionTimeout) {
+            udp.bound = false;
+            req::shared::logWarn("ClientCore", "UDP side-channel timed out, falling back to TCP");
+        }
+    }
+    
+    bool udpTryReceive(ZoneUdpChannel& udp, ZoneMessage& outMessage) {
+        while (true) {
+            boost::asio::ip::udp::endpoint sender;
+            boost::system::error_code ec;
+            std::size_t bytes = udp.socket.receive_from(boost::asio::buffer(udp.receiveBuffer), sender, 0, ec);
+            if (ec == boost::asio::error::would_block || ec == boost::asio::error::try_again) {
+                return false;
+            }
+            if (ec) {
+                // e.g. ICMP port unreachable reported on the next receive; the
+                // keepalive keeps retrying and TCP carries everything meanwhile
+                return false;
+            }
+            if (sender != udp.serverEndpoint || bytes > req::shared::protocol::MaxDatagramBytes) {
+                continue;
+            }
+            if (udpDropForSimulatedLoss(udp)) {
+                continue;
+            }
+            
+            req::shared::protocol::DatagramHeader header;
+            req::shared::MessageHeader messageHeader;
+            std::string_view payload;
+            if (!req::shared::protocol::parseDatagram(std::string_view(udp.receiveBuffer.data(), bytes),
+                                                      header, messageHeader, payload) ||
+                header.characterId != udp.characterId || header.sessionKey != udp.sessionKey) {
+                continue;
+            }
+            
+            if (header.kind != req::shared::protocol::DatagramKind::HelloAck &&
+                header.kind != req::shared::protocol::DatagramKind::Message) {
+                continue;
+            }
+            
+            // Any valid datagram from the server proves it has our endpoint,
+            // so a lost HelloAck does not keep us on TCP
+            if (!udp.bound) {
+                req::shared::logInfo("ClientCore", "UDP side-channel bound");
+            }
+            udp.bound = true;
+            udp.lastReceive = std::chrono::steady_clock::now();
+            
+            if (header.kind == req::shared::protocol::DatagramKind::HelloAck) {
+                ++udp.stats.datagramsReceived;
+                continue;
+            }
+            
+            if (udp.hasReceivedMessage &&
+                !req::shared::protocol::isNewerDatagramSequence(header.sequence, udp.lastReceiveSequence)) {
+                ++udp.stats.datagramsStale;
+                continue;
+            }
+            udp.hasReceivedMessage = true;
+            udp.lastReceiveSequence = header.sequence;
+            ++udp.stats.datagramsReceived;
+            
+            outMessage.type = messageHeader.type;
+            outMessage.payload.assign(payload.begin(), payload.end());
+            return true;
+        }
+    }
+    
+    void openZoneUdp(ClientSession& session) {
+        boost::system::error_code ec;
+        auto address = boost::asio::ip::make_address(session.zoneHost, ec);
+        if (ec) {
+            req::shared::logWarn("ClientCore", "UDP side-channel disabled: invalid zone host: " + ec.message());
+            return;
+        }
+        
+        auto udp = std::make_shared<ZoneUdpChannel>(*session.zoneIoContext);
+        udp->serverEndpoint = boost::asio::ip::udp::endpoint(address, session.zoneUdpPort);
+        udp->socket.open(udp->serverEndpoint.protocol(), ec);
+        if (!ec) {
+            udp->socket.non_blocking(true, ec);
+        }
+        if (ec) {
+            req::shared::logWarn("ClientCore", "UDP side-channel disabled: " + ec.message());
+            return;
+        }
+        
+        udp->characterId = session.selectedCharacterId;
+        udp->sessionKey = session.handoffToken;
+        udp->simulatedLossPercent = session.udpSimulatedLossPercent;
+        session.zoneUdp = udp;
+        
+        // First Hello goes out now; binding completes on a later poll
+        udpService(*udp);
+    }
 }
 
 ZoneAuthResponse connectToZone(ClientSession& session) {
@@ -91,8 +278,14 @@ ZoneAuthResponse connectToZone(ClientSession& session) {
     }
     
     // Build and send ZoneAuthRequest
+    session.zoneCapabilities = 0;
+    session.zoneQuantization = req::shared::protocol::QuantizationParams{};
+    session.zoneUdpPort = 0;
+    session.zoneUdp.reset();
+    session.zonePendingMessages = std::make_shared<std::deque<ZoneMessage>>();
+    session.zoneSnapshotBaselines = std::make_shared<ZoneSnapshotBaselines>();
     std::string requestPayload = req::shared::protocol::buildZoneAuthRequestPayload(
-        session.handoffToken, session.selectedCharacterId);
+        session.handoffToken, session.selectedCharacterId, session.requestedZoneCapabilities);
     
     if (!sendMessage(*session.zoneSocket, req::shared::MessageType::ZoneAuthRequest, requestPayload)) {
         response.result = ZoneAuthResult::ProtocolError;
@@ -140,6 +333,16 @@ ZoneAuthResponse connectToZone(ClientSession& session) {
     // Success
     response.result = ZoneAuthResult::Success;
     response.welcomeMessage = zoneData.welcomeMessage;
+    response.capabilities = zoneData.capabilities;
+    session.zoneCapabilities = zoneData.capabilities & session.requestedZoneCapabilities;
+    if (session.zoneCapabilities & req::shared::protocol::ZoneCapability::QuantizedState) {
+        session.zoneQuantization = zoneData.quantization;
+    }
+    
+    if (session.zoneCapabilities & req::shared::protocol::ZoneCapability::UdpChannel) {
+        session.zoneUdpPort = zoneData.udpPort;
+        openZoneUdp(session);
+    }
     
     return response;
 }
@@ -162,8 +365,30 @@ bool sendMovementIntent(
     intent.facingYawDegrees = facingYaw;
     intent.isJumpPressed = jump;
     intent.clientTimeMs = getClientTimeMs();
+    intent.ackSnapshotId = session.zoneSnapshotBaselines ? session.zoneSnapshotBaselines->ackSnapshotId : 0;
+    
+    std::string payload = req::shared::protocol::buildMovementIntentPayload(
+        intent, req::shared::protocol::wireFormatForCapabilities(session.zoneCapabilities));
+    
+    if (session.zoneUdp) {
+        auto& udp = *session.zoneUdp;
+        udpService(udp);
+        if (udp.bound) {
+            req::shared::MessageHeader header;
+            header.protocolVersion = req::shared::CurrentProtocolVersion;
+            header.type = req::shared::MessageType::MovementIntent;
+            header.payloadSize = static_cast<std::uint32_t>(payload.size());
+            header.reserved = 0;
+            
+            std::string frame(sizeof(header), '\0');
+            std::memcpy(frame.data(), &header, sizeof(header));
+            frame += payload;
+            udpSend(udp, req::shared::protocol::DatagramKind::Message, frame);
+            return true;
+        }
+        ++udp.stats.tcpFallbackSends;
+    }
     
-    std::string payload = req::shared::protocol::buildMovementIntentPayload(intent);
     return sendMessage(*session.zoneSocket, req::shared::MessageType::MovementIntent, payload);
 }
 
@@ -207,7 +432,9 @@ bool sendDevCommand(
     return sendMessage(*session.zoneSocket, req::shared::MessageType::DevCommand, payload);
 }
 
-bool tryReceiveZoneMessage(
+namespace {
+    
+bool receiveNextZoneMessage(
     const ClientSession& session,
     ZoneMessage& outMessage) {
     
@@ -215,6 +442,21 @@ bool tryReceiveZoneMessage(
         return false;
     }
     
+    // Remaining entries of the last MessageBundle come before any new read
+    if (session.zonePendingMessages && !session.zonePendingMessages->empty()) {
+        outMessage = std::move(session.zonePendingMessages->front());
+        session.zonePendingMessages->pop_front();
+        return true;
+    }
+    
+    // Datagram-delivered messages first; TCP below is still drained every call
+    if (session.zoneUdp) {
+        udpService(*session.zoneUdp);
+        if (udpTryReceive(*session.zoneUdp, outMessage)) {
+            return true;
+        }
+    }
+    
     // Set socket to non-blocking mode temporarily
     session.zoneSocket->non_blocking(true);
     
@@ -246,6 +488,24 @@ bool tryReceiveZoneMessage(
     
     session.zoneSocket->non_blocking(false);
     
+    if (header.type == req::shared::MessageType::MessageBundle && session.zonePendingMessages) {
+        std::string_view bundle(reinterpret_cast<const char*>(bodyBytes.data()), bodyBytes.size());
+        bool valid = req::shared::forEachBundleEntry(bundle,
+            [&](req::shared::MessageType type, std::string_view payload) {
+                session.zonePendingMessages->push_back(ZoneMessage{ type, std::string(payload) });
+            });
+        if (!valid) {
+            req::shared::logWarn("ClientCore", "Malformed message bundle from zone server (" +
+                std::to_string(bodyBytes.size()) + " bytes)");
+        }
+        if (session.zonePendingMessages->empty()) {
+            return false;
+        }
+        outMessage = std::move(session.zonePendingMessages->front());
+        session.zonePendingMessages->pop_front();
+        return true;
+    }
+    
     // Fill output message
     outMessage.type = header.type;
     outMessage.payload.assign(bodyBytes.begin(), bodyBytes.end());
@@ -253,7 +513,142 @@ bool tryReceiveZoneMessage(
     return true;
 }
 
+// Echo a zone Ping with our clock (same clock as MovementIntent.clientTimeMs)
+void answerZonePing(const ClientSession& session, std::string_view payload) {
+    req::shared::protocol::ZonePingData ping;
+    if (!req::shared::protocol::parseZonePingPayload(payload, ping)) {
+        return;
+    }
+    
+    req::shared::protocol::ZonePongData pong;
+    pong.pingId = ping.pingId;
+    pong.serverTimeMs = ping.serverTimeMs;
+    pong.clientTimeMs = getClientTimeMs();
+    
+    std::string pongPayload = req::shared::protocol::buildZonePongPayload(pong);
+    sendMessage(*session.zoneSocket, req::shared::MessageType::Pong, pongPayload);
+}
+
+const req::shared::protocol::QuantizationParams* zoneQuantization(const ClientSession& session) {
+    if (session.zoneCapabilities & req::shared::protocol::ZoneCapability::QuantizedState) {
+        return &session.zoneQuantization;
+    }
+    return nullptr;
+}
+
+// Turn a PlayerStateDelta into the full PlayerStateSnapshot it encodes.
+// Returns false (message swallowed) if the baseline is not held.
+bool reconstructZoneSnapshot(const ClientSession& session, ZoneMessage& message) {
+    req::shared::protocol::PlayerStateDeltaData delta;
+    if (!session.zoneSnapshotBaselines ||
+        !req::shared::protocol::parsePlayerStateDeltaPayload(message.payload, delta, zoneQuantization(session))) {
+        return false;
+    }
+    auto& baselines = *session.zoneSnapshotBaselines;
+    
+    static const std::vector<req::shared::protocol::PlayerStateEntry> noBaseline;
+    const std::vector<req::shared::protocol::PlayerStateEntry>* baseline = &noBaseline;
+    if (delta.baselineSnapshotId != 0) {
+        auto it = std::find_if(baselines.received.begin(), baselines.received.end(),
+            [&](const auto& held) { return held.first == delta.baselineSnapshotId; });
+        if (it == baselines.received.end()) {
+            // Keep acking what we have; the server falls back to a full state
+            ++baselines.deltasDropped;
+            return false;
+        }
+        baseline = &it->second;
+    }
+    
+    req::shared::protocol::PlayerStateSnapshotData snapshot;
+    snapshot.snapshotId = delta.snapshotId;
+    if (!req::shared::protocol::applyPlayerStateDelta(*baseline, delta, snapshot.players)) {
+        ++baselines.deltasDropped;
+        return false;
+    }
+    
+    // The server never encodes against anything older than this baseline again
+    while (!baselines.received.empty() && baselines.received.front().first < delta.baselineSnapshotId) {
+        baselines.received.pop_front();
+    }
+    if (baselines.received.empty() || baselines.received.back().first < delta.snapshotId) {
+        baselines.received.emplace_back(delta.snapshotId, snapshot.players);
+        baselines.ackSnapshotId = delta.snapshotId;
+    }
+    while (baselines.received.size() > MaxHeldSnapshotBaselines) {
+        baselines.received.pop_front();
+    }
+    
+    message.type = req::shared::MessageType::PlayerStateSnapshot;
+    message.payload = req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot, req::shared::protocol::WireFormat::Binary);
+    return true;
+}
+
+// Re-encode a quantized PlayerStateSnapshot/EntityUpdate with f32 fields.
+// Returns false (message swallowed) if it does not decode.
+bool expandQuantizedZoneMessage(const ClientSession& session, ZoneMessage& message) {
+    if (!req::shared::protocol::isQuantizedPayload(message.payload)) {
+        return true;
+    }
+    const auto* quantization = zoneQuantization(session);
+    
+    if (message.type == req::shared::MessageType::PlayerStateSnapshot) {
+        req::shared::protocol::PlayerStateSnapshotData snapshot;
+        if (!req::shared::protocol::parsePlayerStateSnapshotPayload(message.payload, snapshot, quantization)) {
+            return false;
+        }
+        message.payload = req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot, req::shared::protocol::WireFormat::Binary);
+    } else if (message.type == req::shared::MessageType::EntityUpdate) {
+        req::shared::protocol::EntityUpdateData update;
+        if (!req::shared::protocol::parseEntityUpdatePayload(message.payload, update, quantization)) {
+            return false;
+        }
+        message.payload = req::shared::protocol::buildEntityUpdatePayload(update, req::shared::protocol::WireFormat::Binary);
+    }
+    return true;
+}
+    
+} // namespace
+
+bool tryReceiveZoneMessage(
+    const ClientSession& session,
+    ZoneMessage& outMessage) {
+    
+    while (receiveNextZoneMessage(session, outMessage)) {
+        // Latency probes are answered here and never reach the caller
+        if (outMessage.type == req::shared::MessageType::Ping) {
+            answerZonePing(session, outMessage.payload);
+            continue;
+        }
+        if (outMessage.type == req::shared::MessageType::PlayerStateDelta &&
+            !reconstructZoneSnapshot(session, outMessage)) {
+            continue;
+        }
+        if (!expandQuantizedZoneMessage(session, outMessage)) {
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+ZoneUdpStats getZoneUdpStats(const ClientSession& session) {
+    if (!session.zoneUdp) {
+        return {};
+    }
+    
+    ZoneUdpStats stats = session.zoneUdp->stats;
+    stats.active = session.zoneUdp->bound &&
+        std::chrono::steady_clock::now() - session.zoneUdp->lastReceive <= UdpSessionTimeout;
+    return stats;
+}
+
 void disconnectFromZone(ClientSession& session) {
+    if (session.zoneUdp) {
+        boost::system::error_code ec;
+        session.zoneUdp->socket.close(ec);
+        session.zoneUdp.reset();
+    }
+    
     if (session.zoneSocket && session.zoneSocket->is_open()) {
         boost::system::error_code ec;
         session.zoneSocket->shutdown(Tcp::socket::shutdown_both, ec);
@@ -262,6 +657,8 @@ void disconnectFromZone(ClientSession& session) {
     
     session.zoneSocket.reset();
     session.zoneIoContext.reset();
+    session.zonePendingMessages.reset();
+    session.zoneSnapshotBaselines.reset();
 }
 
 } // namespace req::clientcore
@@ -4,6 +4,7 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 #include <boost/asio.hpp>
@@ -35,7 +36,7 @@ private:
     void handleNewConnection(Tcp::socket socket);
 
     void handleMessage(const req::shared::MessageHeader& header,
-                       const req::shared::net::Connection::ByteArray& payload,
+                       std::string_view payload,
                        ConnectionPtr connection);
 
     req::shared::SessionToken generateSessionToken();
@@ -68,7 +68,7 @@ void LoginServer::handleNewConnection(Tcp::socket socket) {
     connections_.push_back(connection);
 
     connection->setMessageHandler([this](const req::shared::MessageHeader& header,
-                                         const req::shared::net::Connection::ByteArray& payload,
+                                         std::string_view payload,
                                          std::shared_ptr<req::shared::net::Connection> conn) {
         handleMessage(header, payload, conn);
     });
@@ -96,7 +96,7 @@ std::optional<std::uint64_t> LoginServer::findAccountIdForSessionToken(req::shar
 }
 
 void LoginServer::handleMessage(const req::shared::MessageHeader& header,
-                                const req::shared::net::Connection::ByteArray& payload,
+                                std::string_view payload,
                                 ConnectionPtr connection) {
     // Log protocol version
     req::shared::logInfo("login", std::string{"Received message: type="} + 
@@ -111,7 +111,7 @@ void LoginServer::handleMessage(const req::shared::MessageHeader& header,
         // TODO: In future, enforce strict version matching
     }
 
-    std::string body(payload.begin(), payload.end());
+    std::string_view body = payload;
 
     switch (header.type) {
     case req::shared::MessageType::LoginRequest: {
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <bit>
+
+/*
+ * ByteStream.h
+ *
+ * Minimal little-endian writer/reader used by the binary wire codecs.
+ *
+ * Payloads are carried in std::string (same container as the text protocol)
+ * so binary and text builders are interchangeable at every call site.
+ *
+ * ByteReader never throws: any out-of-bounds read sets ok() to false and
+ * returns zero, so decoders can read every field and check ok() once.
+ */
+
+namespace req::shared {
+
+class ByteWriter {
+public:
+    explicit ByteWriter(std::string& out)
+        : out_(out) {}
+
+    void writeU8(std::uint8_t v) {
+        out_.push_back(static_cast<char>(v));
+    }
+
+    void writeU16(std::uint16_t v) {
+        writeLE(v, 2);
+    }
+
+    void writeU32(std::uint32_t v) {
+        writeLE(v, 4);
+    }
+
+    void writeU64(std::uint64_t v) {
+        writeLE(v, 8);
+    }
+
+    void writeI32(std::int32_t v) {
+        writeU32(static_cast<std::uint32_t>(v));
+    }
+
+    void writeF32(float v) {
+        writeU32(std::bit_cast<std::uint32_t>(v));
+    }
+
+    void writeBool(bool v) {
+        writeU8(v ? 1 : 0);
+    }
+
+    // Length-prefixed (u16) string; truncated at 65535 bytes
+    void writeString(std::string_view s) {
+        std::size_t len = s.size() > 0xFFFF ? 0xFFFF : s.size();
+        writeU16(static_cast<std::uint16_t>(len));
+        out_.append(s.data(), len);
+    }
+
+private:
+    void writeLE(std::uint64_t v, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            out_.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+        }
+    }
+
+    std::string& out_;
+};
+
+class ByteReader {
+public:
+    explicit ByteReader(std::string_view in)
+        : in_(in) {}
+
+    std::uint8_t readU8() {
+        if (!require(1)) {
+            return 0;
+        }
+        return static_cast<std::uint8_t>(in_[pos_++]);
+    }
+
+    std::uint16_t readU16() {
+        return static_cast<std::uint16_t>(readLE(2));
+    }
+
+    std::uint32_t readU32() {
+        return static_cast<std::uint32_t>(readLE(4));
+    }
+
+    std::uint64_t readU64() {
+        return readLE(8);
+    }
+
+    std::int32_t readI32() {
+        return static_cast<std::int32_t>(readU32());
+    }
+
+    float readF32() {
+        return std::bit_cast<float>(readU32());
+    }
+
+    bool readBool() {
+        return readU8() != 0;
+    }
+
+    std::string readString() {
+        std::uint16_t len = readU16();
+        if (!require(len)) {
+            return {};
+        }
+        std::string s(in_.substr(pos_, len));
+        pos_ += len;
+        return s;
+    }
+
+    bool ok() const { return ok_; }
+    std::size_t remaining() const { return in_.size() - pos_; }
+
+private:
+    bool require(std::size_t bytes) {
+        if (!ok_ || in_.size() - pos_ < bytes) {
+            ok_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    std::uint64_t readLE(int bytes) {
+        if (!require(static_cast<std::size_t>(bytes))) {
+            return 0;
+        }
+        std::uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i) {
+            v |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(in_[pos_ + i])) << (8 * i);
+        }
+        pos_ += static_cast<std::size_t>(bytes);
+        return v;
+    }
+
+    std::string_view in_;
+    std::size_t pos_{ 0 };
+    bool ok_{ true };
+};
+
+} // namespace req::shared
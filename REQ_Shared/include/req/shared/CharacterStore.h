@@ -57,6 +57,8 @@ public:
 
     /**
      * Save a character to disk.
+     * The file is replaced atomically (temp file + rename): concurrent
+     * readers see the old or the new contents, never a partial file.
      * Returns true on success, false on failure.
      */
     bool saveCharacter(const data::Character& character) const;
@@ -4,6 +4,7 @@
 #include <vector>
 #include <cstdint>
 #include "Types.h"
+#include "Quantization.h"
 
 // Forward declarations for data types (Phase 2)
 namespace req::shared::data {
@@ -69,10 +70,46 @@ struct ZoneConfig {
     // Position auto-save interval (seconds)
     float autosaveIntervalSec{ 30.0f };
     
+    // Simulation tick
+    float tickRateHz{ 20.0f };              // Fixed simulation steps per second (dt = 1 / tickRateHz)
+    std::uint32_t maxCatchUpTicks{ 5 };     // Steps one late wake-up may run to catch up; older backlog is skipped
+    float tickStatsIntervalSec{ 60.0f };    // Log tick timing (durations, late/skipped/overrun) this often; 0 = off
+    
     // Interest management (snapshot filtering)
     bool broadcastFullState{ true };        // If true, send all players; if false, use interestRadius
     float interestRadius{ 2000.0f };        // Distance threshold for including players
     bool debugInterest{ false };            // Enable debug logging for interest filtering
+    bool deltaSnapshots{ true };            // Offer ZoneCapability::DeltaSnapshots (snapshots as deltas against acked baselines)
+    std::uint32_t snapshotBaselineWindow{ 32 };  // Sent snapshots kept per player as baselines; older acks get a full state
+    bool quantizeState{ true };             // Offer ZoneCapability::QuantizedState (fixed-point pos/vel/yaw on the wire)
+    protocol::QuantizationParams quantization;  // Zone bounds and precision for QuantizedState
+    
+    // NPC simulation level of detail
+    bool npcSleepEnabled{ true };           // Throttle idle NPCs by distance to the nearest player
+    float npcActiveRadius{ 1200.0f };       // Idle NPCs with a player this close are updated every tick
+    float npcWakeRadius{ 2500.0f };         // ... within this radius every npcReducedTickInterval ticks; beyond it they sleep
+    std::uint32_t npcReducedTickInterval{ 4 };  // Tick divisor for the reduced band
+    
+    // NPC AI threading
+    std::uint32_t npcAiThreads{ 0 };        // Worker threads for the NPC AI phase; 0 = evaluate on the simulation thread
+    std::uint32_t npcAiParallelMin{ 128 };  // Fewer NPCs due this tick than this are evaluated on the simulation thread
+    
+    // Networking
+    bool corkWritesDuringTick{ true };      // Hold outgoing writes until the tick finishes, then flush as one gather write
+    std::uint32_t maxOutboundQueueBytes{ 4 * 1024 * 1024 };  // Per-connection unsent byte cap (0 = unlimited)
+    float slowConsumerGraceSec{ 5.0f };     // Time a connection may stay over the cap before it is disconnected
+    std::uint32_t ioThreads{ 0 };           // Extra socket I/O threads; 0 = everything on one thread. Inbound messages are then applied at tick start
+    float pingIntervalSec{ 2.0f };          // Ping each player this often for RTT / clock offset; 0 = off
+    
+    // UDP side-channel for snapshots / movement (ZoneCapability::UdpChannel)
+    bool udpEnabled{ false };               // Offer the unreliable datagram channel to clients that ask for it
+    std::uint16_t udpPort{ 0 };             // UDP listen port; 0 = same number as the TCP port
+    float udpTimeoutSec{ 3.0f };            // Fall back to TCP after this long without a datagram from the client
+    float udpSimulatedLossPercent{ 0.0f };  // Testing only: drop this % of datagrams in each direction
+    
+    // Network stats (NetMetrics)
+    float netStatsIntervalSec{ 60.0f };     // Log a one-line network summary this often; 0 = off
+    std::string netStatsFile;               // If set, also append the full per-type/per-connection report here
 };
 
 // ============================================================================
@@ -4,21 +4,85 @@
 #include <deque>
 #include <vector>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <mutex>
+#include <atomic>
 
 #include <boost/asio.hpp>
 
 #include "MessageHeader.h"
 #include "MessageTypes.h"
 #include "Logger.h"
+#include "NetMetrics.h"
 
 namespace req::shared::net {
 
+/*
+ * Threading
+ * 
+ * All socket operations and handler callbacks run on the socket's executor.
+ * Servers that run io_context on several threads accept each socket onto its
+ * own strand, which serializes them per connection.
+ * 
+ * send(), setCorked(), close() and the queue accessors may be called from any
+ * thread: the outbound queue is guarded by a mutex and the actual write is
+ * dispatched onto the socket's executor (inline when already running there,
+ * so single-threaded servers behave exactly as before).
+ */
 class Connection : public std::enable_shared_from_this<Connection> {
 public:
     using Tcp       = boost::asio::ip::tcp;
     using ByteArray = std::vector<std::uint8_t>;
-    using MessageHandler = std::function<void(const req::shared::MessageHeader&, const ByteArray&, std::shared_ptr<Connection>)>;
+    // Payload view points into the connection's pooled read buffer and is only
+    // valid for the duration of the handler call; copy anything kept longer.
+    using MessageHandler = std::function<void(const req::shared::MessageHeader&, std::string_view, std::shared_ptr<Connection>)>;
     using DisconnectHandler = std::function<void(std::shared_ptr<Connection>)>;
+    
+    // Fully encoded message (MessageHeader + payload), immutable once built.
+    // Shared between every connection it is queued on, so a broadcast encodes
+    // and allocates once regardless of recipient count.
+    using SharedFrame = std::shared_ptr<const ByteArray>;
+    
+    /*
+     * Outbound queue limits
+     * 
+     * Snapshot-class messages (PlayerStateSnapshot) never accumulate: queuing
+     * a new one drops any older snapshot that has not started writing yet.
+     * Everything else is reliable and counts toward maxPendingBytes. A
+     * connection that stays above maxPendingBytes for longer than
+     * slowConsumerGrace is closed as a slow consumer.
+     * 
+     * maxPendingBytes = 0 disables the cap.
+     */
+    struct QueueLimits {
+        std::size_t maxPendingBytes{ 4 * 1024 * 1024 };
+        std::chrono::milliseconds slowConsumerGrace{ 5000 };
+    };
+    
+    /*
+     * Per-connection totals. The per-MessageType breakdown, disconnect
+     * reasons and server-wide aggregates live in the NetMetrics passed to
+     * setMetrics(). Write latency is measured per message from send() to the
+     * completion of the socket write that carried it.
+     */
+    struct Stats {
+        std::uint64_t messagesSent{ 0 };
+        std::uint64_t bytesSent{ 0 };          // Header + payload per message, before bundling
+        std::uint64_t messagesReceived{ 0 };
+        std::uint64_t bytesReceived{ 0 };
+        std::uint64_t writes{ 0 };             // Completed socket writes
+        std::uint64_t wireBytesWritten{ 0 };
+        std::uint64_t bundlesSent{ 0 };
+        std::uint64_t snapshotsSuperseded{ 0 };
+        std::size_t   queueDepth{ 0 };
+        std::size_t   queueDepthHighWater{ 0 };
+        std::size_t   bytesPending{ 0 };
+        std::chrono::microseconds writeLatencyP50{ 0 };
+        std::chrono::microseconds writeLatencyP99{ 0 };
+        std::chrono::microseconds writeLatencyMax{ 0 };
+    };
 
     explicit Connection(Tcp::socket socket);
 
@@ -27,34 +91,114 @@ public:
     void send(req::shared::MessageType type,
               const ByteArray& payload,
               std::uint64_t reserved = 0);
+    
+    // Queue a prebuilt frame (see makeFrame); no per-recipient copy is made
+    void send(const SharedFrame& frame);
+    
+    // Encode header + payload once for fan-out to many connections
+    static SharedFrame makeFrame(req::shared::MessageType type,
+                                 const ByteArray& payload,
+                                 std::uint64_t reserved = 0);
+    static SharedFrame makeFrame(req::shared::MessageType type,
+                                 const std::string& payload,
+                                 std::uint64_t reserved = 0);
 
     void close();
+    
+    // Cork mode: while corked, send() only queues. Uncorking flushes everything
+    // queued so far as one gather write (ZoneServer corks around each tick).
+    void setCorked(bool corked);
+    bool isCorked() const;
+    
+    // Pack runs of small queued messages into MessageBundle frames (see
+    // MessageBundle.h). Only enable once the peer has said it understands
+    // bundles; frames queued before the call are never bundled. Inbound
+    // bundles are always unpacked and delivered to the message handler one
+    // entry at a time.
+    void setBundlingEnabled(bool enabled);
+    
     void setMessageHandler(MessageHandler handler);
     void setDisconnectHandler(DisconnectHandler handler);
     
+    void setQueueLimits(const QueueLimits& limits) { queueLimits_ = limits; }
+    const QueueLimits& getQueueLimits() const { return queueLimits_; }
+    
+    // Outbound queue inspection (messages / bytes not yet fully written)
+    std::size_t queueDepth() const;
+    std::size_t bytesPending() const;
+    
+    // Server-wide aggregate this connection also reports into; set before start()
+    void setMetrics(std::shared_ptr<NetMetrics> metrics) { metrics_ = std::move(metrics); }
+    Stats getStats() const;
+    
+    // "address:port" of the peer, captured at construction ("unknown" if unavailable)
+    const std::string& remoteAddress() const { return remoteAddress_; }
+    
     // Check if connection is closed
     bool isClosed() const { return closed_; }
 
 private:
     void doReadHeader();
     void doReadBody();
+    void dispatchMessage();
+    void dispatchBundle(std::string_view bundle);
+    void recordReceived(req::shared::MessageType type, std::size_t bytes);
     void doWrite();
+    void startWrite();          // Run doWrite() on the socket's executor
+    void enforceQueueLimits();  // Caller holds writeMutex_
     
     // Internal close that can be called multiple times safely
     void closeInternal(const std::string& reason);
 
     Tcp::socket          socket_;
     req::shared::MessageHeader incomingHeader_{};
-    ByteArray            incomingBody_;
+    ByteArray            incomingBody_;  // Pooled read buffer: grows to the largest payload seen, reused for every message
+
+    // Inbound payload limits
+    static constexpr std::size_t MaxInboundPayloadBytes = 1024 * 1024;  // Larger payloads close the connection
+    static constexpr std::size_t RetainedReadBufferBytes = 64 * 1024;   // Release the read buffer after a message larger than this
 
     struct OutgoingMessage {
-        req::shared::MessageHeader header;
-        ByteArray                  body;
+        SharedFrame                frame;  // header + body
+        req::shared::MessageType   type;
+        bool                       bundleable{ false };  // Small enough and queued after bundling was enabled
+        std::chrono::steady_clock::time_point enqueuedAt{};
     };
 
+    // Upper bounds for a single gather write in doWrite()
+    static constexpr std::size_t MaxGatherBuffers = 64;
+    static constexpr std::size_t MaxGatherBytes = 64 * 1024;
+
+    mutable std::mutex          writeMutex_;  // Guards the outbound queue state below
     std::deque<OutgoingMessage> writeQueue_;
-    bool                        writeInProgress_{ false };
-    bool                        closed_{ false };  // Track if connection is closed
+    std::size_t                 writeInFlightCount_{ 0 };  // Messages at front of writeQueue_ owned by the current async_write
+    bool                        writeInProgress_{ false };  // Set when a write is scheduled, cleared once the queue drains
+    bool                        corked_{ false };
+    bool                        bundlingEnabled_{ false };
+    std::size_t                 bytesPending_{ 0 };
+
+    QueueLimits                 queueLimits_{};
+    bool                        overQueueLimit_{ false };
+    bool                        slowConsumerClosePending_{ false };
+    std::chrono::steady_clock::time_point overQueueLimitSince_{};
+    std::atomic<bool>           closed_{ false };  // Track if connection is closed
+
+    // Stats (atomics: updated on the socket executor, read from anywhere)
+    struct Counters {
+        std::atomic<std::uint64_t> messagesSent{ 0 };
+        std::atomic<std::uint64_t> bytesSent{ 0 };
+        std::atomic<std::uint64_t> messagesReceived{ 0 };
+        std::atomic<std::uint64_t> bytesReceived{ 0 };
+        std::atomic<std::uint64_t> writes{ 0 };
+        std::atomic<std::uint64_t> wireBytesWritten{ 0 };
+        std::atomic<std::uint64_t> bundlesSent{ 0 };
+        std::atomic<std::uint64_t> snapshotsSuperseded{ 0 };
+    };
+    Counters                    counters_;
+    std::size_t                 queueDepthHighWater_{ 0 };  // Guarded by writeMutex_
+    LatencyHistogram            writeLatency_;
+    std::shared_ptr<NetMetrics> metrics_;
+    std::string                 remoteAddress_;
 
     MessageHandler              onMessage_;
     DisconnectHandler           onDisconnect_;
@@ -6,6 +6,7 @@
 #include <unordered_map>
 
 #include "Types.h"
+#include "HateList.h"
 
 // Include json for serialization function definitions
 #include "../../REQ_Shared/thirdparty/nlohmann/json.hpp"
@@ -481,6 +482,16 @@ enum class NpcAiState {
     Dead        // Waiting for respawn timer
 };
 
+/**
+ * NPC simulation level of detail, from the distance to the nearest player.
+ * Only Idle and dead NPCs are throttled; any other AI state runs every tick.
+ */
+enum class NpcActivity {
+    Active,     // Player within npc_active_radius: updated every tick
+    Reduced,    // Player within npc_wake_radius: updated every npc_reduced_tick_interval ticks
+    Asleep      // No player nearby: not updated (dead NPCs still respawn on time)
+};
+
 /**
  * ZoneNpc
  * 
@@ -528,8 +539,8 @@ struct ZoneNpc {
     // AI state machine
     NpcAiState aiState{ NpcAiState::Idle };
     
-    // Hate table (entityId -> hate amount)
-    std::unordered_map<std::uint64_t, float> hateTable;
+    // Hate table (entityId -> hate amount, top entry tracked)
+    HateList hateTable;
     std::uint64_t currentTargetId{ 0 };     // EntityId with highest hate
     
     // AI timers
@@ -540,6 +551,11 @@ struct ZoneNpc {
     
     // Movement
     float moveSpeed{ 50.0f };               // Movement speed in units/sec
+    
+    // Simulation level of detail
+    NpcActivity activity{ NpcActivity::Active };
+    float activityCheckTimer{ 0.0f };       // Time until the nearest-player check runs again
+    float unsimulatedSec{ 0.0f };           // Time passed since the NPC was last updated
 };
 
 // ============================================================================
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * HateList.h
+ *
+ * An NPC's hate list: entity id -> accumulated hate, with the top entry kept
+ * up to date as hate is added, so reading the current target is O(1).
+ *
+ *   - Entries live in a flat array inside the list (no allocation) up to
+ *     InlineCapacity, which covers a full group plus pets and most raid
+ *     pulls. A larger list moves to one heap vector.
+ *   - add() scans the (small, contiguous) entries for the id. It only
+ *     compares the changed entry with the current top; the top changes only
+ *     when another entry becomes strictly greater, so ties keep the
+ *     current target.
+ *   - remove() swaps the last entry into the gap. Only removing the top
+ *     entry rescans, and among equal hates the rescan picks the earliest
+ *     entry in the list.
+ *
+ * Iteration order is the order the entries were added, except that remove
+ * moves the last entry into the removed one's place.
+ */
+
+namespace req::shared::data {
+
+class HateList {
+public:
+    static constexpr std::size_t InlineCapacity = 16;
+
+    struct Entry {
+        std::uint64_t entityId{ 0 };
+        float hate{ 0.0f };
+    };
+
+    // Adds 'amount' to entityId's hate, capped at maxHate. Returns true if
+    // the entity was not on the list before.
+    bool add(std::uint64_t entityId, float amount, float maxHate) {
+        Entry* entries = data();
+        std::size_t index = 0;
+        while (index < size_ && entries[index].entityId != entityId) {
+            ++index;
+        }
+
+        bool added = index == size_;
+        if (added) {
+            append(Entry{ entityId, 0.0f });
+            entries = data();
+        }
+        entries[index].hate = std::min(entries[index].hate + amount, maxHate);
+
+        if (top_ == NoTop || entries[index].hate > entries[top_].hate) {
+            top_ = index;
+        }
+        return added;
+    }
+
+    // Returns false if the entity was not on the list
+    bool remove(std::uint64_t entityId) {
+        Entry* entries = data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (entries[i].entityId != entityId) {
+                continue;
+            }
+            bool wasTop = top_ == i;
+            std::size_t last = size_ - 1;
+            entries[i] = entries[last];
+            if (top_ == last) {
+                top_ = i;  // The top entry moved into the gap
+            }
+            --size_;
+            if (!overflow_.empty()) {
+                overflow_.pop_back();
+            }
+            if (wasTop) {
+                rescanTop();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void clear() {
+        size_ = 0;
+        top_ = NoTop;
+        overflow_.clear();
+    }
+
+    // 0 if the entity is not on the list
+    float hateFor(std::uint64_t entityId) const {
+        for (const Entry& entry : *this) {
+            if (entry.entityId == entityId) {
+                return entry.hate;
+            }
+        }
+        return 0.0f;
+    }
+    bool contains(std::uint64_t entityId) const {
+        for (const Entry& entry : *this) {
+            if (entry.entityId == entityId) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Entity with the most hate, 0 if the list is empty
+    std::uint64_t topTarget() const { return top_ == NoTop ? 0 : data()[top_].entityId; }
+    float topHate() const { return top_ == NoTop ? 0.0f : data()[top_].hate; }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const Entry* begin() const { return data(); }
+    const Entry* end() const { return data() + size_; }
+
+private:
+    static constexpr std::size_t NoTop = static_cast<std::size_t>(-1);
+
+    // While the list fits inline, overflow_ is empty; once it has grown past
+    // InlineCapacity, every entry lives in overflow_ (size_ == overflow_.size())
+    Entry* data() { return overflow_.empty() ? inline_.data() : overflow_.data(); }
+    const Entry* data() const { return overflow_.empty() ? inline_.data() : overflow_.data(); }
+
+    void append(const Entry& entry) {
+        if (overflow_.empty() && size_ < InlineCapacity) {
+            inline_[size_++] = entry;
+            return;
+        }
+        if (overflow_.empty()) {
+            overflow_.assign(inline_.begin(), inline_.begin() + size_);
+        }
+        overflow_.push_back(entry);
+        ++size_;
+    }
+
+    void rescanTop() {
+        top_ = NoTop;
+        const Entry* entries = data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (top_ == NoTop || entries[i].hate > entries[top_].hate) {
+                top_ = i;
+            }
+        }
+    }
+
+    std::array<Entry, InlineCapacity> inline_{};
+    std::vector<Entry> overflow_;
+    std::size_t size_{ 0 };
+    std::size_t top_{ NoTop };
+};
+
+} // namespace req::shared::data
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "MessageTypes.h"
+#include "ByteStream.h"
+
+/*
+ * MessageBundle.h
+ *
+ * Payload format of MessageType::MessageBundle: several small messages packed
+ * into one frame so a burst (e.g. EntitySpawn for every NPC at zone entry)
+ * costs one 16-byte MessageHeader and one read on the receiving side instead
+ * of one per message.
+ *
+ * The payload is a sequence of entries, little-endian, no count prefix:
+ *
+ *   u16 type | u32 payloadSize | payloadSize bytes
+ *
+ * Bundles never nest and entries carry no 'reserved' field (always 0 after
+ * unpacking). Connection builds bundles on the send side only when
+ * setBundlingEnabled(true) was called for that peer, and always unpacks them
+ * on the receive side.
+ */
+
+namespace req::shared {
+
+inline constexpr std::size_t BundleEntryHeaderBytes = 6;
+
+// Messages with a larger payload are always sent as their own frame
+inline constexpr std::size_t MaxBundledPayloadBytes = 1024;
+
+// Upper bound for one bundle payload; a burst larger than this becomes several bundles
+inline constexpr std::size_t MaxBundlePayloadBytes = 16 * 1024;
+
+inline void appendBundleEntry(std::vector<std::uint8_t>& bundle,
+                              MessageType type,
+                              const std::uint8_t* payload,
+                              std::size_t payloadSize) {
+    auto typeValue = static_cast<std::uint16_t>(type);
+    auto size = static_cast<std::uint32_t>(payloadSize);
+    bundle.push_back(static_cast<std::uint8_t>(typeValue & 0xFF));
+    bundle.push_back(static_cast<std::uint8_t>(typeValue >> 8));
+    for (int i = 0; i < 4; ++i) {
+        bundle.push_back(static_cast<std::uint8_t>((size >> (8 * i)) & 0xFF));
+    }
+    bundle.insert(bundle.end(), payload, payload + payloadSize);
+}
+
+// Calls fn(MessageType, std::string_view payload) for each entry in order.
+// Views point into 'bundle'. Returns false (possibly after delivering some
+// entries) if the bundle is truncated or contains a nested bundle.
+template<typename Fn>
+bool forEachBundleEntry(std::string_view bundle, Fn&& fn) {
+    while (!bundle.empty()) {
+        ByteReader reader(bundle.substr(0, BundleEntryHeaderBytes));
+        auto type = static_cast<MessageType>(reader.readU16());
+        std::uint32_t size = reader.readU32();
+        if (!reader.ok() || type == MessageType::MessageBundle ||
+            bundle.size() - BundleEntryHeaderBytes < size) {
+            return false;
+        }
+        fn(type, bundle.substr(BundleEntryHeaderBytes, size));
+        bundle.remove_prefix(BundleEntryHeaderBytes + size);
+    }
+    return true;
+}
+
+} // namespace req::shared
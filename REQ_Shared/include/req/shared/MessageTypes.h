@@ -8,6 +8,7 @@ enum class MessageType : std::uint16_t {
     // Generic / debug
     Ping = 0,   // Client or server ping
     Pong = 1,   // Response to Ping
+    MessageBundle = 2,  // Several small messages in one frame (see MessageBundle.h)
 
     // Login server handshake/auth
     LoginRequest      = 10, // Client requests login with credentials
@@ -41,6 +42,7 @@ enum class MessageType : std::uint16_t {
     EntitySpawn           = 44, // ZoneServer notifies client of entity spawn (player or NPC)
     EntityUpdate          = 45, // ZoneServer sends periodic entity position/state update
     EntityDespawn         = 46, // ZoneServer notifies client of entity despawn/death
+    PlayerStateDelta      = 47, // PlayerStateSnapshot as a delta against an acked baseline (DeltaSnapshots)
     
     // Dev commands (for testing)
     DevCommand            = 50, // Client sends dev command to ZoneServer
@@ -65,4 +67,48 @@ enum class MessageType : std::uint16_t {
 
 // TODO: Reserve ranges per subsystem, define payload structures, document versioning.
 
+// Enum name for logs and stats dumps ("Unknown" for values not listed above)
+inline const char* messageTypeName(MessageType type) {
+    switch (type) {
+    case MessageType::Ping:                    return "Ping";
+    case MessageType::Pong:                    return "Pong";
+    case MessageType::MessageBundle:           return "MessageBundle";
+    case MessageType::LoginRequest:            return "LoginRequest";
+    case MessageType::LoginResponse:           return "LoginResponse";
+    case MessageType::WorldAuthRequest:        return "WorldAuthRequest";
+    case MessageType::WorldAuthResponse:       return "WorldAuthResponse";
+    case MessageType::CharacterListRequest:    return "CharacterListRequest";
+    case MessageType::CharacterListResponse:   return "CharacterListResponse";
+    case MessageType::CharacterCreateRequest:  return "CharacterCreateRequest";
+    case MessageType::CharacterCreateResponse: return "CharacterCreateResponse";
+    case MessageType::EnterWorldRequest:       return "EnterWorldRequest";
+    case MessageType::EnterWorldResponse:      return "EnterWorldResponse";
+    case MessageType::ZoneAuthRequest:         return "ZoneAuthRequest";
+    case MessageType::ZoneAuthResponse:        return "ZoneAuthResponse";
+    case MessageType::MovementIntent:          return "MovementIntent";
+    case MessageType::PlayerStateSnapshot:     return "PlayerStateSnapshot";
+    case MessageType::AttackRequest:           return "AttackRequest";
+    case MessageType::AttackResult:            return "AttackResult";
+    case MessageType::EntitySpawn:             return "EntitySpawn";
+    case MessageType::EntityUpdate:            return "EntityUpdate";
+    case MessageType::EntityDespawn:           return "EntityDespawn";
+    case MessageType::PlayerStateDelta:        return "PlayerStateDelta";
+    case MessageType::DevCommand:              return "DevCommand";
+    case MessageType::DevCommandResponse:      return "DevCommandResponse";
+    case MessageType::GroupInviteRequest:      return "GroupInviteRequest";
+    case MessageType::GroupInviteResponse:     return "GroupInviteResponse";
+    case MessageType::GroupAcceptRequest:      return "GroupAcceptRequest";
+    case MessageType::GroupDeclineRequest:     return "GroupDeclineRequest";
+    case MessageType::GroupLeaveRequest:       return "GroupLeaveRequest";
+    case MessageType::GroupKickRequest:        return "GroupKickRequest";
+    case MessageType::GroupDisbandRequest:     return "GroupDisbandRequest";
+    case MessageType::GroupUpdateNotify:       return "GroupUpdateNotify";
+    case MessageType::GroupChatMessage:        return "GroupChatMessage";
+    case MessageType::PlayerState:             return "PlayerState";
+    case MessageType::NpcSpawn:                return "NpcSpawn";
+    case MessageType::ChatMessage:             return "ChatMessage";
+    }
+    return "Unknown";
+}
+
 } // namespace req::shared
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * MotionKernel.h
+ *
+ * Player movement integration over structure-of-arrays storage. The zone
+ * keeps the hot movement fields of every player in one MotionTable (one row
+ * per player, dense; removal moves the last row into the hole) so the
+ * per-tick step reads a few contiguous float arrays instead of one scattered
+ * ZonePlayer per player.
+ *
+ * One step, per enabled row:
+ *   - input clamped to unit length, velocity XY = input * moveSpeed
+ *   - on the ground: velZ = jumpVelocity if jump is held, else 0;
+ *     in the air:    velZ += gravity * dt
+ *   - pos += vel * dt, clamped to groundLevel (velZ = 0 on landing)
+ *   - moved more than moveSpeed * dt * maxAllowedMoveMultiplier *
+ *     suspiciousMoveMultiplier from lastValid: snap back to lastValid and
+ *     stop; otherwise lastValid = pos
+ *
+ * integrateMotion runs four rows at a time with SSE2 where the target has it
+ * and handles the tail (and other targets) with integrateMotionScalar, the
+ * reference implementation. Both perform the same IEEE operations in the
+ * same order, so their results are bit-identical as long as the compiler
+ * does not contract the scalar multiply-adds into FMAs (MSVC and GCC do not
+ * on plain x64 targets).
+ */
+
+namespace req::shared {
+
+struct MotionParams {
+    float dt{ 0.05f };
+    float moveSpeed{ 70.0f };
+    float gravity{ -30.0f };
+    float jumpVelocity{ 10.0f };
+    float groundLevel{ 0.0f };
+    float maxAllowedMoveMultiplier{ 1.5f };   // Slack for network jitter
+    float suspiciousMoveMultiplier{ 5.0f };   // On top of the slack: clearly insane movement
+};
+
+// Per-row result bits in MotionTable::flags (cleared by every step)
+namespace MotionFlag {
+    constexpr std::uint8_t Moved = 1 << 0;        // Position or velocity changed
+    constexpr std::uint8_t Dirty = 1 << 1;        // Accepted move of more than 0.01 units (needs saving)
+    constexpr std::uint8_t SnappedBack = 1 << 2;  // Move rejected by the sanity check
+    constexpr std::uint8_t Jumped = 1 << 3;
+}
+
+class MotionTable {
+public:
+    static constexpr std::uint32_t NoSlot = 0xFFFFFFFFu;
+
+    // Appends a zeroed, disabled row for 'id' and returns its slot
+    std::uint32_t add(std::uint64_t id);
+    // Removes the row in 'slot' by moving the last row into it. Returns the
+    // id of the row that now lives in 'slot', or 0 if none moved.
+    std::uint64_t remove(std::uint32_t slot);
+
+    std::size_t size() const { return ids.size(); }
+    void clear();
+
+    std::vector<std::uint64_t> ids;
+
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> velX, velY, velZ;
+    std::vector<float> lastValidX, lastValidY, lastValidZ;
+    std::vector<float> inputX, inputY;
+    std::vector<std::uint8_t> jump;     // 1 while jump is held
+    std::vector<std::uint8_t> enabled;  // 0 = row is left untouched (dead / not yet in world)
+
+    // Outputs of the last step
+    std::vector<float> moveDist;        // Distance of the attempted move from lastValid
+    std::vector<std::uint8_t> flags;    // MotionFlag bits
+};
+
+void integrateMotion(MotionTable& table, const MotionParams& params);
+void integrateMotionScalar(MotionTable& table, const MotionParams& params, std::size_t firstRow = 0);
+
+// True if integrateMotion has a vectorized path on this build
+bool motionKernelIsVectorized();
+
+} // namespace req::shared
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+/*
+ * MpscQueue.h
+ *
+ * Unbounded lock-free multi-producer / single-consumer queue (node-based,
+ * Vyukov style). Any thread may push(); only one thread at a time may call
+ * tryPop() or drain().
+ *
+ * push() is one allocation plus one atomic exchange and never blocks. A
+ * producer that has exchanged the head but not yet linked its node makes the
+ * queue look empty to the consumer for that instant; the element is picked up
+ * by the next drain, so FIFO order per producer is always preserved.
+ */
+
+namespace req::shared {
+
+template<typename T>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_(&stub_), tail_(&stub_) {}
+
+    ~MpscQueue() {
+        T discarded;
+        while (tryPop(discarded)) {
+        }
+        if (tail_ != &stub_) {
+            delete tail_;
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Safe from any thread
+    void push(T value) {
+        Node* node = new Node;
+        node->value.emplace(std::move(value));
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Consumer thread only. Returns false when nothing is available.
+    bool tryPop(T& out) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        out = std::move(*next->value);
+        next->value.reset();
+        tail_ = next;  // 'next' becomes the new (empty) stub
+        if (tail != &stub_) {
+            delete tail;
+        }
+        return true;
+    }
+
+    // Consumer thread only. Pops at most maxItems elements and hands each to fn.
+    template<typename Fn>
+    std::size_t drain(Fn&& fn, std::size_t maxItems = static_cast<std::size_t>(-1)) {
+        std::size_t count = 0;
+        T item;
+        while (count < maxItems && tryPop(item)) {
+            fn(std::move(item));
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{ nullptr };
+        std::optional<T>   value;
+    };
+
+    Node               stub_;
+    std::atomic<Node*> head_;  // Producers push here
+    Node*              tail_;  // Consumer pops here
+};
+
+} // namespace req::shared
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MessageTypes.h"
+
+namespace req::shared::net {
+
+/*
+ * LatencyHistogram
+ *
+ * Log2-bucketed microsecond histogram: bucket i counts samples below 2^i us,
+ * the last bucket everything from ~1 s up. record() is lock-free and may be
+ * called from any thread; readers see a consistent-enough view for stats.
+ * Percentiles are reported as the upper bound of the bucket they fall in.
+ */
+class LatencyHistogram {
+public:
+    static constexpr std::size_t BucketCount = 22;
+
+    void record(std::chrono::microseconds latency);
+
+    std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    std::chrono::microseconds percentile(double p) const;  // p in [0,1]; 0 when empty
+    std::chrono::microseconds max() const { return std::chrono::microseconds(maxUs_.load(std::memory_order_relaxed)); }
+
+    // "n=.. p50<=..us p99<=..us max=..us"
+    std::string summary() const;
+
+private:
+    std::array<std::atomic<std::uint64_t>, BucketCount> buckets_{};
+    std::atomic<std::uint64_t> count_{ 0 };
+    std::atomic<std::int64_t>  maxUs_{ 0 };
+};
+
+/*
+ * NetMetrics
+ *
+ * Server-wide network counters. Every Connection given the same NetMetrics
+ * (Connection::setMetrics) adds to it, so one object covers all of a server's
+ * connections, including ones that have already closed. All record* calls are
+ * thread-safe.
+ *
+ * Message counts are logical: a MessageBundle entry counts as its own type,
+ * and bytes are header + payload as if it had been sent alone. Physical
+ * writes and wire bytes are counted separately.
+ */
+class NetMetrics {
+public:
+    // MessageType values at or above this are counted in the last slot
+    static constexpr std::size_t TrackedMessageTypes = 128;
+
+    struct TypeTotals {
+        MessageType   type{ MessageType::Ping };
+        std::uint64_t messagesSent{ 0 };
+        std::uint64_t bytesSent{ 0 };
+        std::uint64_t messagesReceived{ 0 };
+        std::uint64_t bytesReceived{ 0 };
+    };
+
+    void recordSent(MessageType type, std::size_t bytes);
+    void recordReceived(MessageType type, std::size_t bytes);
+    void recordWrite(std::size_t wireBytes, std::size_t bundles);  // One completed socket write
+    void recordWriteLatency(std::chrono::microseconds latency);   // Enqueue -> fully written, per message
+    void recordQueueDepth(std::size_t depth);
+    void recordRtt(std::chrono::microseconds rtt);                // Application-level round trip (Ping/Pong)
+    void recordSnapshotSuperseded();
+    void recordConnectionOpened();
+    void recordDisconnect(std::string_view reason);
+
+    // Types that saw traffic, largest total bytes first
+    std::vector<TypeTotals> typeTotals() const;
+    std::map<std::string, std::uint64_t> disconnectReasons() const;
+    const LatencyHistogram& writeLatency() const { return writeLatency_; }
+    const LatencyHistogram& rtt() const { return rtt_; }
+
+    // Multi-line dump for CLI commands and stats files
+    std::string formatReport(std::string_view title) const;
+    // Single line for periodic logs
+    std::string formatSummary() const;
+
+private:
+    struct TypeCounters {
+        std::atomic<std::uint64_t> messagesSent{ 0 };
+        std::atomic<std::uint64_t> bytesSent{ 0 };
+        std::atomic<std::uint64_t> messagesReceived{ 0 };
+        std::atomic<std::uint64_t> bytesReceived{ 0 };
+    };
+
+    static std::size_t slotFor(MessageType type);
+
+    std::array<TypeCounters, TrackedMessageTypes> types_{};
+    LatencyHistogram writeLatency_;
+    LatencyHistogram rtt_;
+
+    std::atomic<std::uint64_t> writes_{ 0 };
+    std::atomic<std::uint64_t> wireBytesWritten_{ 0 };
+    std::atomic<std::uint64_t> bundlesSent_{ 0 };
+    std::atomic<std::uint64_t> snapshotsSuperseded_{ 0 };
+    std::atomic<std::uint64_t> queueDepthHighWater_{ 0 };
+    std::atomic<std::uint64_t> connectionsOpened_{ 0 };
+    std::atomic<std::uint64_t> connectionsClosed_{ 0 };
+
+    mutable std::mutex disconnectMutex_;  // Disconnects are rare; a map under a lock is fine
+    std::map<std::string, std::uint64_t> disconnectReasons_;
+};
+
+} // namespace req::shared::net
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+
+/*
+ * ProtocolParse.h
+ *
+ * Non-allocating text helpers shared by the Protocol_*.cpp parsers.
+ *
+ * Tokens are std::string_view slices of the inbound payload, so a parse does
+ * not copy the payload or any field except the ones stored as std::string in
+ * the output struct. Numbers are converted with std::from_chars.
+ *
+ * The toInt/toFloat/toUInt64 helpers throw std::invalid_argument like the
+ * std::stoi/stof/stoull calls they replace, so existing try/catch parse
+ * code keeps its shape.
+ */
+
+namespace req::shared::protocol::detail {
+
+// Split by delimiter; views point into 's' and are valid as long as it is
+inline std::vector<std::string_view> split(std::string_view s, char delim) {
+    std::vector<std::string_view> tokens;
+    std::size_t start = 0;
+    while (true) {
+        auto pos = s.find(delim, start);
+        if (pos == std::string_view::npos) {
+            tokens.emplace_back(s.substr(start));
+            break;
+        }
+        tokens.emplace_back(s.substr(start, pos - start));
+        start = pos + 1;
+    }
+    return tokens;
+}
+
+// Skip leading whitespace and an optional '+', as std::sto* did
+inline std::string_view trimNumber(std::string_view s) {
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+        s.remove_prefix(1);
+    }
+    if (!s.empty() && s.front() == '+') {
+        s.remove_prefix(1);
+    }
+    return s;
+}
+
+// Parse unsigned integer safely (no exceptions)
+template<typename T>
+bool parseUInt(std::string_view s, T& out) {
+    s = trimNumber(s);
+    T value{};
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+    if (ec != std::errc{} || ptr == s.data()) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+template<typename T>
+T toNumber(std::string_view s, const char* what) {
+    s = trimNumber(s);
+    T value{};
+    auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+    if (ec != std::errc{} || ptr == s.data()) {
+        throw std::invalid_argument(what);
+    }
+    return value;
+}
+
+inline std::int32_t toInt(std::string_view s) {
+    return toNumber<std::int32_t>(s, "toInt");
+}
+
+inline std::int64_t toInt64(std::string_view s) {
+    return toNumber<std::int64_t>(s, "toInt64");
+}
+
+inline std::uint64_t toUInt64(std::string_view s) {
+    return toNumber<std::uint64_t>(s, "toUInt64");
+}
+
+inline float toFloat(std::string_view s) {
+    return toNumber<float>(s, "toFloat");
+}
+
+} // namespace req::shared::protocol::detail
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -89,7 +90,7 @@ std::string buildCharacterListRequestPayload(
     WorldId worldId);
 
 bool parseCharacterListRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId);
 
@@ -119,7 +120,7 @@ std::string buildCharacterListResponseErrorPayload(
     const std::string& errorMessage);
 
 bool parseCharacterListResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     CharacterListResponseData& outData);
 
 // ============================================================================
@@ -148,7 +149,7 @@ std::string buildCharacterCreateRequestPayload(
     const std::string& characterClass);
 
 bool parseCharacterCreateRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId,
     std::string& outName,
@@ -186,7 +187,7 @@ std::string buildCharacterCreateResponseErrorPayload(
     const std::string& errorMessage);
 
 bool parseCharacterCreateResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     CharacterCreateResponseData& outData);
 
 // ============================================================================
@@ -211,7 +212,7 @@ std::string buildEnterWorldRequestPayload(
     std::uint64_t characterId);
 
 bool parseEnterWorldRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId,
     std::uint64_t& outCharacterId);
@@ -245,7 +246,7 @@ std::string buildEnterWorldResponseErrorPayload(
     const std::string& errorMessage);
 
 bool parseEnterWorldResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     EnterWorldResponseData& outData);
 
 } // namespace req::shared::protocol
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 
+#include "Protocol_Zone.h"  // WireFormat
+
 /*
  * Protocol_Combat.h
  * 
@@ -74,7 +77,7 @@ std::string buildAttackRequestPayload(
     const AttackRequestData& data);
 
 bool parseAttackRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     AttackRequestData& outData);
 
 // ============================================================================
@@ -105,14 +108,19 @@ bool parseAttackRequestPayload(
  * Example: "42|1001|25|1|75|0|Hit for 25 damage" (success, hit for 25, target has 75 HP left)
  * Example: "42|1001|0|0|100|1|Target out of range" (miss, out of range)
  * 
+ * Binary format (BinaryHotMessages, 32 bytes + message):
+ *   u8 marker | u64 attackerId | u64 targetId | i32 damage | u8 wasHit |
+ *   i32 remainingHp | i32 resultCode | u16 messageLength | message bytes
+ * 
  * Note: Message is sent to attacker and potentially nearby clients for combat log.
  *       resultCode 0 = success, non-zero = various failure conditions.
  */
 std::string buildAttackResultPayload(
-    const AttackResultData& data);
+    const AttackResultData& data,
+    WireFormat format = WireFormat::Text);
 
 bool parseAttackResultPayload(
-    const std::string& payload,
+    std::string_view payload,
     AttackResultData& outData);
 
 } // namespace req::shared::protocol
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 /*
@@ -63,7 +64,7 @@ std::string buildDevCommandPayload(
     const DevCommandData& data);
 
 bool parseDevCommandPayload(
-    const std::string& payload,
+    std::string_view payload,
     DevCommandData& outData);
 
 // ============================================================================
@@ -86,7 +87,7 @@ std::string buildDevCommandResponsePayload(
     const DevCommandResponseData& data);
 
 bool parseDevCommandResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     DevCommandResponseData& outData);
 
 } // namespace req::shared::protocol
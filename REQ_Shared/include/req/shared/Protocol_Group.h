@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <vector>
 
@@ -129,14 +130,14 @@ std::string buildGroupChatMessagePayload(const GroupChatMessageData& data);
 // Parse Functions
 // ============================================================================
 
-bool parseGroupInviteRequestPayload(const std::string& payload, GroupInviteRequestData& out);
-bool parseGroupInviteResponsePayload(const std::string& payload, GroupInviteResponseData& out);
-bool parseGroupAcceptRequestPayload(const std::string& payload, GroupAcceptRequestData& out);
-bool parseGroupDeclineRequestPayload(const std::string& payload, GroupDeclineRequestData& out);
-bool parseGroupLeaveRequestPayload(const std::string& payload, GroupLeaveRequestData& out);
-bool parseGroupKickRequestPayload(const std::string& payload, GroupKickRequestData& out);
-bool parseGroupDisbandRequestPayload(const std::string& payload, GroupDisbandRequestData& out);
-bool parseGroupUpdateNotifyPayload(const std::string& payload, GroupUpdateNotifyData& out);
-bool parseGroupChatMessagePayload(const std::string& payload, GroupChatMessageData& out);
+bool parseGroupInviteRequestPayload(std::string_view payload, GroupInviteRequestData& out);
+bool parseGroupInviteResponsePayload(std::string_view payload, GroupInviteResponseData& out);
+bool parseGroupAcceptRequestPayload(std::string_view payload, GroupAcceptRequestData& out);
+bool parseGroupDeclineRequestPayload(std::string_view payload, GroupDeclineRequestData& out);
+bool parseGroupLeaveRequestPayload(std::string_view payload, GroupLeaveRequestData& out);
+bool parseGroupKickRequestPayload(std::string_view payload, GroupKickRequestData& out);
+bool parseGroupDisbandRequestPayload(std::string_view payload, GroupDisbandRequestData& out);
+bool parseGroupUpdateNotifyPayload(std::string_view payload, GroupUpdateNotifyData& out);
+bool parseGroupChatMessagePayload(std::string_view payload, GroupChatMessageData& out);
 
 } // namespace req::shared::protocol
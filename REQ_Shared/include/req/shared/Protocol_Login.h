@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -74,7 +75,7 @@ std::string buildLoginRequestPayload(
     LoginMode mode = LoginMode::Login);
 
 bool parseLoginRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     std::string& outUsername,
     std::string& outPassword,
     std::string& outClientVersion,
@@ -116,7 +117,7 @@ std::string buildLoginResponseErrorPayload(
     const std::string& errorMessage);
 
 bool parseLoginResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     LoginResponseData& outData);
 
 } // namespace req::shared::protocol
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 #include "Types.h"
@@ -52,7 +53,7 @@ std::string buildWorldAuthRequestPayload(
     WorldId worldId);
 
 bool parseWorldAuthRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId);
 
@@ -85,7 +86,7 @@ std::string buildWorldAuthResponseErrorPayload(
     const std::string& errorMessage);
 
 bool parseWorldAuthResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     WorldAuthResponseData& outData);
 
 } // namespace req::shared::protocol
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
 #include "Types.h"
+#include "MessageHeader.h"
+#include "Quantization.h"
 
 /*
  * Protocol_Zone.h
@@ -16,6 +19,80 @@
 
 namespace req::shared::protocol {
 
+// ============================================================================
+// Wire Format / Capability Negotiation
+// ============================================================================
+
+/*
+ * ZoneCapability
+ * 
+ * Bitmask negotiated once per connection at ZoneAuthRequest time.
+ * The client sends the capabilities it understands; the server answers with
+ * the subset it will actually use (see ZoneAuthRequest / ZoneAuthResponse).
+ * Clients that omit the field get the plain text protocol for everything.
+ * 
+ *   BinaryHotMessages: MovementIntent, PlayerStateSnapshot, EntityUpdate and
+ *                      AttackResult are sent in their binary encoding.
+ *   UdpChannel:        PlayerStateSnapshot, EntityUpdate and MovementIntent may
+ *                      travel over the unreliable UDP side-channel (see
+ *                      "UDP Side-Channel" below). Only granted when the zone
+ *                      has UDP enabled; the response then carries the UDP port.
+ *   MessageBundles:    after the ZoneAuthResponse, the server may pack bursts of
+ *                      small messages into MessageType::MessageBundle frames
+ *                      (see MessageBundle.h). The client unpacks them in order.
+ *   DeltaSnapshots:    PlayerStateSnapshot is replaced by PlayerStateDelta,
+ *                      encoded against the last snapshot the client acknowledged
+ *                      (MovementIntent ackSnapshotId). Only granted together
+ *                      with BinaryHotMessages.
+ *   QuantizedState:    PlayerStateSnapshot, PlayerStateDelta and EntityUpdate
+ *                      carry position/velocity/yaw as fixed-point values (see
+ *                      Quantization.h) under QuantizedPayloadMarker. The
+ *                      response carries the zone's QuantizationParams. Only
+ *                      granted together with BinaryHotMessages.
+ */
+namespace ZoneCapability {
+    constexpr std::uint32_t None = 0;
+    constexpr std::uint32_t BinaryHotMessages = 1u << 0;
+    constexpr std::uint32_t UdpChannel = 1u << 1;
+    constexpr std::uint32_t MessageBundles = 1u << 2;
+    constexpr std::uint32_t DeltaSnapshots = 1u << 3;
+    constexpr std::uint32_t QuantizedState = 1u << 4;
+}
+
+// Capabilities this build of the zone server/client can speak
+constexpr std::uint32_t SupportedZoneCapabilities =
+    ZoneCapability::BinaryHotMessages | ZoneCapability::UdpChannel | ZoneCapability::MessageBundles |
+    ZoneCapability::DeltaSnapshots | ZoneCapability::QuantizedState;
+
+enum class WireFormat : std::uint8_t {
+    Text,
+    Binary
+};
+
+/*
+ * Binary payloads begin with BinaryPayloadMarker. Text payloads always start
+ * with a printable ASCII character, so the parse functions for hot messages
+ * detect the encoding from the first byte and accept either one.
+ * 
+ * All binary integers/floats are little-endian (see ByteStream.h).
+ */
+constexpr std::uint8_t BinaryPayloadMarker = 0xB1;
+
+// Binary layout with quantized entity state (ZoneCapability::QuantizedState)
+constexpr std::uint8_t QuantizedPayloadMarker = 0xB2;
+
+inline bool isBinaryPayload(std::string_view payload) {
+    return !payload.empty() && static_cast<std::uint8_t>(payload[0]) == BinaryPayloadMarker;
+}
+
+inline bool isQuantizedPayload(std::string_view payload) {
+    return !payload.empty() && static_cast<std::uint8_t>(payload[0]) == QuantizedPayloadMarker;
+}
+
+inline WireFormat wireFormatForCapabilities(std::uint32_t capabilities) {
+    return (capabilities & ZoneCapability::BinaryHotMessages) ? WireFormat::Binary : WireFormat::Text;
+}
+
 // ============================================================================
 // Data Structures for Parsed Payloads
 // ============================================================================
@@ -25,6 +102,9 @@ struct ZoneAuthResponseData {
     
     // Success fields
     std::string welcomeMessage;
+    std::uint32_t capabilities{ ZoneCapability::None };  // Negotiated ZoneCapability bits (0 if server sent none)
+    std::uint16_t udpPort{ 0 };                          // UDP side-channel port (only with ZoneCapability::UdpChannel)
+    QuantizationParams quantization;                     // Zone's parameters (only with ZoneCapability::QuantizedState)
     
     // Error fields
     std::string errorCode;
@@ -49,6 +129,7 @@ struct MovementIntentData {
     float facingYawDegrees{ 0.0f };      // Facing direction: 0-360 degrees
     bool isJumpPressed{ false };         // Jump button state
     std::uint64_t clientTimeMs{ 0 };     // Client timestamp (for debugging/telemetry) - 64-bit to handle large values
+    std::uint64_t ackSnapshotId{ 0 };    // Newest snapshot the client has applied (DeltaSnapshots baseline); 0 = none
 };
 
 /*
@@ -81,6 +162,38 @@ struct PlayerStateSnapshotData {
     std::vector<PlayerStateEntry> players;             // All players in this snapshot
 };
 
+/*
+ * PlayerStateDeltaData
+ * 
+ * A PlayerStateSnapshot expressed against an earlier snapshot (the baseline)
+ * that the client acknowledged. Entries unchanged since the baseline are
+ * omitted; changed entries carry only the fields in fieldMask; players that
+ * left the interest set are listed in removed. baselineSnapshotId 0 means
+ * "no baseline": every entry is complete and replaces the client's state.
+ */
+namespace PlayerStateField {
+    constexpr std::uint8_t PosX = 1u << 0;
+    constexpr std::uint8_t PosY = 1u << 1;
+    constexpr std::uint8_t PosZ = 1u << 2;
+    constexpr std::uint8_t VelX = 1u << 3;
+    constexpr std::uint8_t VelY = 1u << 4;
+    constexpr std::uint8_t VelZ = 1u << 5;
+    constexpr std::uint8_t Yaw  = 1u << 6;
+    constexpr std::uint8_t All  = 0x7F;
+}
+
+struct PlayerStateDeltaEntry {
+    PlayerStateEntry state;                            // Fields outside fieldMask are unspecified
+    std::uint8_t fieldMask{ PlayerStateField::All };
+};
+
+struct PlayerStateDeltaData {
+    std::uint64_t snapshotId{ 0 };
+    std::uint64_t baselineSnapshotId{ 0 };             // 0 = full state
+    std::vector<PlayerStateDeltaEntry> changed;
+    std::vector<std::uint64_t> removed;                // characterIds present in the baseline but not here
+};
+
 /*
  * EntitySpawnData
  * 
@@ -140,6 +253,24 @@ struct EntityDespawnData {
     std::uint32_t reason{ 0 };            // Despawn reason code
 };
 
+/*
+ * ZonePingData / ZonePongData
+ * 
+ * Latency probe. The server stamps each Ping with its own clock; the client
+ * answers with a Pong that echoes it and adds the client clock (the same
+ * clock as MovementIntentData::clientTimeMs).
+ */
+struct ZonePingData {
+    std::uint32_t pingId{ 0 };            // Increments per ping to this client
+    std::uint64_t serverTimeMs{ 0 };      // Server clock when the ping was sent
+};
+
+struct ZonePongData {
+    std::uint32_t pingId{ 0 };            // Echoed from the Ping
+    std::uint64_t serverTimeMs{ 0 };      // Echoed from the Ping
+    std::uint64_t clientTimeMs{ 0 };      // Client clock when the Ping was answered
+};
+
 // ============================================================================
 // ZoneAuthRequest / ZoneAuthResponse
 // ============================================================================
@@ -147,7 +278,7 @@ struct EntityDespawnData {
 /*
  * ZoneAuthRequest (client ? ZoneServer)
  * 
- * Wire Format: handoffToken|characterId
+ * Wire Format: handoffToken|characterId[|capabilities]
  * Delimiter: pipe character (|)
  * 
  * Fields (in order):
@@ -160,10 +291,14 @@ struct EntityDespawnData {
  *      - The character to enter the zone with
  *      - Example: "42"
  * 
- * Complete Example: "987654321|42"
+ *   3. capabilities (optional): decimal ZoneCapability bitmask the client supports
+ *      - Omitted by older clients (treated as 0 = text only)
+ *      - Example: "1"
+ * 
+ * Complete Example: "987654321|42" or "987654321|42|1"
  * 
  * Validation Requirements:
- *   - Exactly 2 fields separated by |
+ *   - At least 2 fields separated by |
  *   - Both fields must parse as unsigned 64-bit integers
  *   - handoffToken must not be 0 (InvalidHandoffToken)
  * 
@@ -173,17 +308,24 @@ struct EntityDespawnData {
  */
 std::string buildZoneAuthRequestPayload(
     HandoffToken handoffToken,
-    PlayerId characterId);
+    PlayerId characterId,
+    std::uint32_t capabilities = ZoneCapability::None);
 
 bool parseZoneAuthRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     HandoffToken& outHandoffToken,
     PlayerId& outCharacterId);
 
+bool parseZoneAuthRequestPayload(
+    std::string_view payload,
+    HandoffToken& outHandoffToken,
+    PlayerId& outCharacterId,
+    std::uint32_t& outCapabilities);
+
 /*
  * ZoneAuthResponse (ZoneServer ? client)
  * 
- * Success Wire Format: OK|welcomeMessage
+ * Success Wire Format: OK|welcomeMessage[|capabilities[|udpPort[|quantization]]]
  * Error Wire Format: ERR|errorCode|errorMessage
  * Delimiter: pipe character (|)
  * 
@@ -192,6 +334,15 @@ bool parseZoneAuthRequestPayload(
  *   2. welcomeMessage: human-readable zone welcome text
  *      - May contain zone name, zone ID, world ID
  *      - Example: "Welcome to East Freeport (zone 10 on world 1)"
+ *   3. capabilities (optional): negotiated ZoneCapability bitmask
+ *      - Only sent when the client requested capabilities
+ *      - Client must use exactly these for the rest of the session
+ *   4. udpPort (optional): UDP side-channel port
+ *      - Sent when capabilities includes UdpChannel, and as 0 when a
+ *        quantization field follows without UdpChannel
+ *   5. quantization (optional): comma-separated QuantizationParams
+ *      - Only sent when capabilities includes QuantizedState
+ *      - minX,minY,minZ,maxX,maxY,maxZ,positionBits,yawBits,velocityBits,maxSpeed
  * 
  * Error Fields:
  *   1. status: literal string "ERR"
@@ -211,14 +362,17 @@ bool parseZoneAuthRequestPayload(
  *   - All error paths are logged with context
  */
 std::string buildZoneAuthResponseOkPayload(
-    const std::string& welcomeMessage);
+    const std::string& welcomeMessage,
+    std::uint32_t capabilities = ZoneCapability::None,
+    std::uint16_t udpPort = 0,
+    const QuantizationParams* quantization = nullptr);
 
 std::string buildZoneAuthResponseErrorPayload(
     const std::string& errorCode,
     const std::string& errorMessage);
 
 bool parseZoneAuthResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     ZoneAuthResponseData& outData);
 
 // ============================================================================
@@ -228,7 +382,7 @@ bool parseZoneAuthResponsePayload(
 /*
  * MovementIntent (client ? ZoneServer)
  * 
- * Payload format: characterId|sequenceNumber|inputX|inputY|facingYawDegrees|isJumpPressed|clientTimeMs
+ * Payload format: characterId|sequenceNumber|inputX|inputY|facingYawDegrees|isJumpPressed|clientTimeMs[|ackSnapshotId]
  * 
  * Fields:
  *   - characterId: decimal character ID sending the input
@@ -238,17 +392,23 @@ bool parseZoneAuthResponsePayload(
  *   - facingYawDegrees: float facing direction (0-360 degrees, server normalizes)
  *   - isJumpPressed: 0 or 1 (jump button state)
  *   - clientTimeMs: decimal client timestamp in milliseconds
+ *   - ackSnapshotId: optional, newest snapshot applied (DeltaSnapshots); absent = 0
  * 
- * Example: "42|123|0.5|-1.0|90.0|1|1234567890"
+ * Example: "42|123|0.5|-1.0|90.0|1|1234567890|77"
+ * 
+ * Binary format (BinaryHotMessages, 42 bytes; 34 from clients without the ack):
+ *   u8 marker | u64 characterId | u32 sequenceNumber | f32 inputX | f32 inputY |
+ *   f32 facingYawDegrees | u8 isJumpPressed | u64 clientTimeMs | u64 ackSnapshotId
  * 
  * Note: This is part of the server-authoritative movement model.
  *       Client position is NOT sent - only input. Server computes position.
  */
 std::string buildMovementIntentPayload(
-    const MovementIntentData& data);
+    const MovementIntentData& data,
+    WireFormat format = WireFormat::Text);
 
 bool parseMovementIntentPayload(
-    const std::string& payload,
+    std::string_view payload,
     MovementIntentData& outData);
 
 // ============================================================================
@@ -269,15 +429,80 @@ bool parseMovementIntentPayload(
  * 
  * Example: "5|2|42,100.5,200.0,10.0,0.0,0.0,0.0,90.0|43,150.0,200.0,10.0,1.5,0.0,0.0,180.0"
  * 
+ * Binary format (BinaryHotMessages, 11 + 36 bytes per player):
+ *   u8 marker | u64 snapshotId | u16 playerCount |
+ *   playerCount x (u64 characterId | f32 posX,posY,posZ | f32 velX,velY,velZ | f32 yawDegrees)
+ * 
+ * Quantized format (QuantizedState, QuantizedPayloadMarker):
+ *   same layout with pos as positionBits, vel as velocityBits and yaw as
+ *   yawBits per value (18-25 bytes per player instead of 36)
+ * 
  * Note: This is the authoritative state from the server.
+ *       Quantized payloads can only be built/parsed with the session's params.
  *       Clients use this to render player positions, not their own predicted state.
  */
 std::string buildPlayerStateSnapshotPayload(
-    const PlayerStateSnapshotData& data);
+    const PlayerStateSnapshotData& data,
+    WireFormat format = WireFormat::Text,
+    const QuantizationParams* quantization = nullptr);  // Binary only: quantized layout
 
 bool parsePlayerStateSnapshotPayload(
-    const std::string& payload,
-    PlayerStateSnapshotData& outData);
+    std::string_view payload,
+    PlayerStateSnapshotData& outData,
+    const QuantizationParams* quantization = nullptr);  // Required for quantized payloads
+
+// ============================================================================
+// PlayerStateDelta (ZoneServer ? client, DeltaSnapshots)
+// ============================================================================
+
+/*
+ * PlayerStateDelta (ZoneServer ? client)
+ * 
+ * Binary only (negotiated together with BinaryHotMessages):
+ *   u8 marker | u64 snapshotId | u64 baselineSnapshotId | u16 changedCount | u16 removedCount |
+ *   changedCount x (u64 characterId | u8 fieldMask | one f32 per set bit, in
+ *                   PlayerStateField order: posX,posY,posZ,velX,velY,velZ,yaw) |
+ *   removedCount x u64 characterId
+ * 
+ * With QuantizedState the marker is QuantizedPayloadMarker and each field is
+ * its quantized width instead of f32. The server diffs the quantized values,
+ * so a field only counts as changed when its quantized value changed.
+ * 
+ * Acknowledgement: the client reports the newest snapshotId it reconstructed
+ * in MovementIntentData::ackSnapshotId. The server encodes against that
+ * snapshot while it still has it, and falls back to a full state
+ * (baselineSnapshotId 0) when the ack is missing or too old. A client that
+ * does not hold the baseline drops the delta and keeps acking its last one.
+ * 
+ * Clients keep the snapshots they reconstructed from baselineSnapshotId
+ * onwards; older ones are never referenced again.
+ */
+std::string buildPlayerStateDeltaPayload(
+    const PlayerStateDeltaData& data,
+    const QuantizationParams* quantization = nullptr);
+
+bool parsePlayerStateDeltaPayload(
+    std::string_view payload,
+    PlayerStateDeltaData& outData,
+    const QuantizationParams* quantization = nullptr);  // Required for quantized payloads
+
+// Replace pos/vel/yaw with the values a client decodes (for diffing quantized state)
+void snapPlayerStateToQuantized(PlayerStateEntry& entry, const QuantizationParams& params);
+
+// Fill outDelta.changed/removed with the difference baseline -> current.
+// Both vectors must be sorted by characterId. Fields compare bit-exact.
+void diffPlayerStates(
+    const std::vector<PlayerStateEntry>& baseline,
+    const std::vector<PlayerStateEntry>& current,
+    PlayerStateDeltaData& outDelta);
+
+// Rebuild the full state (sorted by characterId) from baseline + delta.
+// baseline must be sorted and empty when delta.baselineSnapshotId is 0.
+// Returns false if an entry with a partial mask is not in the baseline.
+bool applyPlayerStateDelta(
+    const std::vector<PlayerStateEntry>& baseline,
+    const PlayerStateDeltaData& delta,
+    std::vector<PlayerStateEntry>& outState);
 
 // ============================================================================
 // EntitySpawn (ZoneServer ? client)
@@ -308,7 +533,7 @@ std::string buildEntitySpawnPayload(
     const EntitySpawnData& data);
 
 bool parseEntitySpawnPayload(
-    const std::string& payload,
+    std::string_view payload,
     EntitySpawnData& outData);
 
 // ============================================================================
@@ -329,14 +554,23 @@ bool parseEntitySpawnPayload(
  * 
  * Example: "1001|105.5|52.3|0.0|95.0|15|1"
  * 
+ * Binary format (BinaryHotMessages, 30 bytes):
+ *   u8 marker | u64 entityId | f32 posX,posY,posZ | f32 heading | i32 hp | u8 state
+ * 
+ * Quantized format (QuantizedState, QuantizedPayloadMarker, 15-23 bytes):
+ *   same layout with pos as positionBits and heading as yawBits per value
+ * 
  * Note: Sent periodically for NPCs (e.g., 5-10 Hz) for position and HP updates.
  */
 std::string buildEntityUpdatePayload(
-    const EntityUpdateData& data);
+    const EntityUpdateData& data,
+    WireFormat format = WireFormat::Text,
+    const QuantizationParams* quantization = nullptr);  // Binary only: quantized layout
 
 bool parseEntityUpdatePayload(
-    const std::string& payload,
-    EntityUpdateData& outData);
+    std::string_view payload,
+    EntityUpdateData& outData,
+    const QuantizationParams* quantization = nullptr);  // Required for quantized payloads
 
 // ============================================================================
 // EntityDespawn (ZoneServer ? client)
@@ -359,7 +593,115 @@ std::string buildEntityDespawnPayload(
     const EntityDespawnData& data);
 
 bool parseEntityDespawnPayload(
-    const std::string& payload,
+    std::string_view payload,
     EntityDespawnData& outData);
 
+// ============================================================================
+// Ping / Pong (ZoneServer <-> client)
+// ============================================================================
+
+/*
+ * Ping (ZoneServer -> client)
+ * 
+ * Payload format: pingId|serverTimeMs
+ * 
+ * Sent every ping_interval_sec (zone config). Clients answer immediately with
+ * a Pong; ClientCore does this inside tryReceiveZoneMessage().
+ * 
+ * Example: "12|84350"
+ */
+std::string buildZonePingPayload(
+    const ZonePingData& data);
+
+bool parseZonePingPayload(
+    std::string_view payload,
+    ZonePingData& outData);
+
+/*
+ * Pong (client -> ZoneServer)
+ * 
+ * Payload format: pingId|serverTimeMs|clientTimeMs
+ * 
+ * The server derives round-trip time from the echoed serverTimeMs and the
+ * server-minus-client clock offset from clientTimeMs (assuming a symmetric
+ * path), and smooths both per player.
+ * 
+ * Example: "12|84350|1203377"
+ */
+std::string buildZonePongPayload(
+    const ZonePongData& data);
+
+bool parseZonePongPayload(
+    std::string_view payload,
+    ZonePongData& outData);
+
+// ============================================================================
+// UDP Side-Channel (ZoneServer <-> client, unreliable)
+// ============================================================================
+
+/*
+ * Datagram
+ * 
+ * Optional per-session UDP channel negotiated with ZoneCapability::UdpChannel.
+ * Carries only messages where the newest copy supersedes older ones
+ * (PlayerStateSnapshot, EntityUpdate, MovementIntent), so a lost datagram
+ * never stalls anything behind it. Everything else stays on TCP, and either
+ * side falls back to TCP whenever the channel is not bound or has gone quiet.
+ * 
+ * Binary Format (little-endian):
+ *   u32 magic       DatagramMagic
+ *   u8  kind        DatagramKind
+ *   u64 characterId character the session belongs to
+ *   u64 sessionKey  handoff token used for ZoneAuthRequest
+ *   u32 sequence    per-sender counter, +1 per datagram
+ *   [kind == Message] MessageHeader (16 bytes, same as TCP) + payload
+ * 
+ * Session:
+ *   1. After a ZoneAuthResponse granting UdpChannel, the client sends Hello
+ *      to udpPort (and again every DatagramKeepaliveInterval as keepalive).
+ *   2. The server checks characterId + sessionKey against the authenticated
+ *      session, records the source endpoint and answers HelloAck.
+ *   3. Both sides may now send Message datagrams; a receiver drops any
+ *      datagram whose sequence is not newer than the last one accepted.
+ *   4. A side that hears nothing for the session timeout stops using UDP
+ *      and sends over TCP until the next Hello/HelloAck.
+ * 
+ * Messages whose datagram would exceed MaxDatagramBytes are sent over TCP.
+ */
+enum class DatagramKind : std::uint8_t {
+    Hello    = 1,  // client -> server: bind / keepalive
+    HelloAck = 2,  // server -> client: binding accepted
+    Message  = 3   // either direction: one framed message
+};
+
+constexpr std::uint32_t DatagramMagic = 0x52455144;  // "REQD"
+constexpr std::size_t DatagramHeaderBytes = 25;
+constexpr std::size_t MaxDatagramBytes = 1200;      // Stay under a typical path MTU
+constexpr std::uint32_t DatagramKeepaliveIntervalMs = 1000;
+
+struct DatagramHeader {
+    DatagramKind kind{ DatagramKind::Hello };
+    std::uint64_t characterId{ 0 };
+    std::uint64_t sessionKey{ 0 };
+    std::uint32_t sequence{ 0 };
+};
+
+// True if 'sequence' is newer than 'last' (wrap-around safe)
+inline bool isNewerDatagramSequence(std::uint32_t sequence, std::uint32_t last) {
+    return static_cast<std::int32_t>(sequence - last) > 0;
+}
+
+// 'frame' is a complete MessageHeader + payload (kind == Message only)
+std::string buildDatagram(
+    const DatagramHeader& header,
+    std::string_view frame = {});
+
+// For Message datagrams outMessageHeader/outPayload describe the carried
+// message; outPayload points into 'datagram'
+bool parseDatagram(
+    std::string_view datagram,
+    DatagramHeader& outHeader,
+    MessageHeader& outMessageHeader,
+    std::string_view& outPayload);
+
 } // namespace req::shared::protocol
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "ByteStream.h"
+
+/*
+ * Quantization.h
+ *
+ * Fixed-point encodings for entity state on the wire (ZoneCapability::
+ * QuantizedState). Server and clients must use the same QuantizationParams;
+ * the zone sends its parameters in the ZoneAuthResponse.
+ *
+ *   Position: unsigned 16 or 24 bits per axis, relative to the zone's
+ *             minimum bound. Step = (max - min) / (2^bits - 1); values
+ *             outside the bounds clamp to the edge.
+ *   Yaw:      unsigned 8 or 16 bits over [0, 360).
+ *   Velocity: signed 8 or 16 bits per component over [-maxSpeed, maxSpeed].
+ *
+ * All values round to the nearest step, so the error is at most half a step.
+ */
+
+namespace req::shared::protocol {
+
+// Quantized fields, in the same order as the PlayerStateField bits
+enum class QuantizedField : std::uint8_t {
+    PosX = 0,
+    PosY,
+    PosZ,
+    VelX,
+    VelY,
+    VelZ,
+    Yaw
+};
+constexpr std::uint8_t QuantizedFieldCount = 7;
+
+struct QuantizationParams {
+    // Zone bounds; the minimum corner is the position origin
+    float boundsMinX{ -32768.0f };
+    float boundsMinY{ -32768.0f };
+    float boundsMinZ{ -1024.0f };
+    float boundsMaxX{ 32768.0f };
+    float boundsMaxY{ 32768.0f };
+    float boundsMaxZ{ 1024.0f };
+
+    std::uint8_t positionBits{ 24 };  // 16 or 24 per axis
+    std::uint8_t yawBits{ 16 };       // 8 or 16
+    std::uint8_t velocityBits{ 8 };   // 8 or 16 per component
+    float maxSpeed{ 256.0f };         // Velocity components clamp to +-maxSpeed
+};
+
+// Empty string if valid, otherwise what is wrong (for config errors)
+std::string validateQuantizationParams(const QuantizationParams& params);
+
+// Text form for the ZoneAuthResponse:
+// minX,minY,minZ,maxX,maxY,maxZ,positionBits,yawBits,velocityBits,maxSpeed
+std::string buildQuantizationParamsField(const QuantizationParams& params);
+bool parseQuantizationParamsField(std::string_view field, QuantizationParams& outParams);
+
+std::uint32_t quantizePosition(float value, float boundsMin, float boundsMax, std::uint8_t bits);
+float dequantizePosition(std::uint32_t quantized, float boundsMin, float boundsMax, std::uint8_t bits);
+
+std::uint32_t quantizeYaw(float degrees, std::uint8_t bits);
+float dequantizeYaw(std::uint32_t quantized, std::uint8_t bits);
+
+std::int32_t quantizeVelocity(float value, float maxSpeed, std::uint8_t bits);
+float dequantizeVelocity(std::int32_t quantized, float maxSpeed, std::uint8_t bits);
+
+// Per-field helpers used by the protocol codecs
+std::size_t quantizedFieldBytes(QuantizedField field, const QuantizationParams& params);
+void writeQuantizedField(ByteWriter& writer, QuantizedField field, float value, const QuantizationParams& params);
+float readQuantizedField(ByteReader& reader, QuantizedField field, const QuantizationParams& params);
+
+// The value a client decodes for 'value' (quantize + dequantize)
+float snapToQuantized(QuantizedField field, float value, const QuantizationParams& params);
+
+} // namespace req::shared::protocol
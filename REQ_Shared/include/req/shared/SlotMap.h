@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * SlotMap.h
+ *
+ * SlotMap<T>: values stored contiguously, addressed by generational handles.
+ *
+ *   - insert/emplace return a SlotHandle {index, generation}
+ *   - get(handle) is O(1) with no hashing; a handle whose value was erased
+ *     (even if the slot has been reused since) returns nullptr
+ *   - iteration walks one dense std::vector<T>
+ *   - erase moves the last value into the gap, so iteration order is
+ *     insertion order except that erasing moves the last element into the
+ *     erased element's place. The order depends only on the sequence of
+ *     operations, never on hashing, so ticks that walk it are deterministic.
+ *
+ * DenseMap<Key, T>: a SlotMap of std::pair<Key, T> plus a Key -> handle index,
+ * with the subset of the std::unordered_map interface the zone server uses
+ * (find / operator[] / erase / range-for over [key, value]). Iteration is over
+ * the dense pairs; lookups by key cost one hash probe plus one slot access.
+ * Callers that look the same value up repeatedly can keep handleOf(key)
+ * and use get(handle) instead.
+ *
+ * Unlike std::unordered_map, references and iterators are invalidated by any
+ * insert (the vector may grow) and by erasing another element (the last
+ * element moves). erase(iterator) returns an iterator to the element now at
+ * that position, so "it = map.erase(it)" loops visit every element once.
+ *
+ * Not thread-safe.
+ */
+
+namespace req::shared {
+
+struct SlotHandle {
+    static constexpr std::uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+    std::uint32_t index{ InvalidIndex };
+    std::uint32_t generation{ 0 };
+
+    bool isValid() const { return index != InvalidIndex; }
+    friend bool operator==(const SlotHandle& a, const SlotHandle& b) {
+        return a.index == b.index && a.generation == b.generation;
+    }
+    friend bool operator!=(const SlotHandle& a, const SlotHandle& b) { return !(a == b); }
+};
+
+template<typename T>
+class SlotMap {
+public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    template<typename... Args>
+    SlotHandle emplace(Args&&... args) {
+        std::uint32_t index;
+        if (freeHead_ != SlotHandle::InvalidIndex) {
+            index = freeHead_;
+            freeHead_ = slots_[index].densePos;
+        } else {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{});
+        }
+
+        values_.emplace_back(std::forward<Args>(args)...);
+        denseToSlot_.push_back(index);
+        slots_[index].densePos = static_cast<std::uint32_t>(values_.size() - 1);
+        return SlotHandle{ index, slots_[index].generation };
+    }
+
+    SlotHandle insert(T value) { return emplace(std::move(value)); }
+
+    // Returns false if the handle was already stale
+    bool erase(SlotHandle handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        Slot& slot = slots_[handle.index];
+        std::uint32_t pos = slot.densePos;
+        std::uint32_t last = static_cast<std::uint32_t>(values_.size() - 1);
+        if (pos != last) {
+            values_[pos] = std::move(values_[last]);
+            denseToSlot_[pos] = denseToSlot_[last];
+            slots_[denseToSlot_[pos]].densePos = pos;
+        }
+        values_.pop_back();
+        denseToSlot_.pop_back();
+
+        ++slot.generation;  // Outstanding handles to this slot go stale
+        slot.densePos = freeHead_;
+        freeHead_ = handle.index;
+        return true;
+    }
+
+    bool contains(SlotHandle handle) const {
+        // erase bumps the generation, so a live generation means a live value
+        return handle.index < slots_.size() && slots_[handle.index].generation == handle.generation;
+    }
+
+    T* get(SlotHandle handle) {
+        return contains(handle) ? &values_[slots_[handle.index].densePos] : nullptr;
+    }
+    const T* get(SlotHandle handle) const {
+        return contains(handle) ? &values_[slots_[handle.index].densePos] : nullptr;
+    }
+
+    // Position in iteration order; only meaningful for a live handle
+    std::size_t densePosition(SlotHandle handle) const { return slots_[handle.index].densePos; }
+    SlotHandle handleAt(std::size_t densePos) const {
+        std::uint32_t index = denseToSlot_[densePos];
+        return SlotHandle{ index, slots_[index].generation };
+    }
+
+    std::size_t size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    void reserve(std::size_t count) {
+        values_.reserve(count);
+        denseToSlot_.reserve(count);
+        slots_.reserve(count);
+    }
+    // Drops all values; every handle handed out so far goes stale
+    void clear() {
+        while (!values_.empty()) {
+            erase(handleAt(values_.size() - 1));
+        }
+    }
+
+    iterator begin() { return values_.begin(); }
+    iterator end() { return values_.end(); }
+    const_iterator begin() const { return values_.begin(); }
+    const_iterator end() const { return values_.end(); }
+
+private:
+    struct Slot {
+        std::uint32_t densePos{ 0 };     // Next free slot while the slot is free
+        std::uint32_t generation{ 0 };
+    };
+
+    std::vector<T> values_;
+    std::vector<std::uint32_t> denseToSlot_;  // Parallel to values_
+    std::vector<Slot> slots_;
+    std::uint32_t freeHead_{ SlotHandle::InvalidIndex };
+};
+
+template<typename Key, typename T, typename Hash = std::hash<Key>>
+class DenseMap {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = std::size_t;
+    using iterator = typename SlotMap<value_type>::iterator;
+    using const_iterator = typename SlotMap<value_type>::const_iterator;
+
+    iterator find(const Key& key) {
+        auto it = index_.find(key);
+        return it == index_.end() ? values_.end() : values_.begin() + values_.densePosition(it->second);
+    }
+    const_iterator find(const Key& key) const {
+        auto it = index_.find(key);
+        return it == index_.end() ? values_.end() : values_.begin() + values_.densePosition(it->second);
+    }
+
+    bool contains(const Key& key) const { return index_.find(key) != index_.end(); }
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    // Inserts a default T if the key is missing
+    T& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            return { values_.begin() + values_.densePosition(it->second), false };
+        }
+        SlotHandle handle = values_.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        index_.emplace(key, handle);
+        return { values_.begin() + values_.densePosition(handle), true };
+    }
+
+    size_type erase(const Key& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return 0;
+        }
+        values_.erase(it->second);
+        index_.erase(it);
+        return 1;
+    }
+
+    // Returns an iterator to the element that now occupies the erased position
+    iterator erase(iterator pos) {
+        auto offset = pos - values_.begin();
+        erase(Key(pos->first));
+        return values_.begin() + offset;
+    }
+
+    // Handles stay valid until the key is erased, across any other inserts/erases
+    SlotHandle handleOf(const Key& key) const {
+        auto it = index_.find(key);
+        return it == index_.end() ? SlotHandle{} : it->second;
+    }
+    T* get(SlotHandle handle) {
+        value_type* entry = values_.get(handle);
+        return entry ? &entry->second : nullptr;
+    }
+    const T* get(SlotHandle handle) const {
+        const value_type* entry = values_.get(handle);
+        return entry ? &entry->second : nullptr;
+    }
+
+    size_type size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    void reserve(size_type count) {
+        values_.reserve(count);
+        index_.reserve(count);
+    }
+    void clear() {
+        values_.clear();
+        index_.clear();
+    }
+
+    iterator begin() { return values_.begin(); }
+    iterator end() { return values_.end(); }
+    const_iterator begin() const { return values_.begin(); }
+    const_iterator end() const { return values_.end(); }
+
+private:
+    SlotMap<value_type> values_;
+    std::unordered_map<Key, SlotHandle, Hash> index_;
+};
+
+} // namespace req::shared
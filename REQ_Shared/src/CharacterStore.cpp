@@ -372,17 +372,36 @@ bool CharacterStore::saveCharacter(const data::Character& character) const {
     std::string filename = m_charactersRootDirectory + "/" + 
                           std::to_string(character.characterId) + ".json";
     
+    // Written to a temp file and renamed over the old one, so a reader in
+    // another zone or process sees either the old file or the new one, never
+    // a truncated one. The ".tmp" extension keeps it out of directory scans.
+    std::string tempFilename = filename + ".tmp";
+    
     try {
         json j = character;
         
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            logError("CharacterStore", "Failed to open character file for writing: " + filename);
-            return false;
+        {
+            std::ofstream file(tempFilename, std::ios::trunc);
+            if (!file.is_open()) {
+                logError("CharacterStore", "Failed to open character file for writing: " + tempFilename);
+                return false;
+            }
+            
+            file << j.dump(4); // Pretty print with 4-space indent
+            file.close();
+            if (file.fail()) {
+                logError("CharacterStore", "Failed to write character file: " + tempFilename);
+                return false;
+            }
         }
         
-        file << j.dump(4); // Pretty print with 4-space indent
-        file.close();
+        std::error_code ec;
+        fs::rename(tempFilename, filename, ec);
+        if (ec) {
+            logError("CharacterStore", "Failed to replace character file " + filename + ": " + ec.message());
+            fs::remove(tempFilename, ec);
+            return false;
+        }
         
         return true;
     } catch (const json::exception& e) {
@@ -293,10 +293,66 @@ ZoneConfig loadZoneConfig(const std::string& path) {
     // Auto-save interval (optional, default 30s)
     cfg.autosaveIntervalSec = getOrDefault<float>(j, "autosave_interval_sec", 30.0f);
     
+    // Simulation tick (optional, default 20 Hz, catch up at most 5 steps, timing log once a minute)
+    cfg.tickRateHz = getOrDefault<float>(j, "tick_rate_hz", 20.0f);
+    cfg.maxCatchUpTicks = getOrDefault<std::uint32_t>(j, "max_catch_up_ticks", 5);
+    cfg.tickStatsIntervalSec = getOrDefault<float>(j, "tick_stats_interval_sec", 60.0f);
+    
     // Interest management (optional, defaults: broadcast_full_state=true, interest_radius=2000.0)
     cfg.broadcastFullState = getOrDefault<bool>(j, "broadcast_full_state", true);
     cfg.interestRadius = getOrDefault<float>(j, "interest_radius", 2000.0f);
     cfg.debugInterest = getOrDefault<bool>(j, "debug_interest", false);
+    cfg.deltaSnapshots = getOrDefault<bool>(j, "delta_snapshots", true);
+    cfg.snapshotBaselineWindow = getOrDefault<std::uint32_t>(j, "snapshot_baseline_window", 32);
+    
+    // State quantization (optional, default on with +-32768 xy / +-1024 z bounds, 24/16/8 bits)
+    cfg.quantizeState = getOrDefault<bool>(j, "quantize_state", true);
+    if (j.contains("quantization") && j["quantization"].is_object()) {
+        const auto& quant = j["quantization"];
+        if (quant.contains("bounds_min") && quant["bounds_min"].is_object()) {
+            const auto& boundsMin = quant["bounds_min"];
+            cfg.quantization.boundsMinX = getOrDefault<float>(boundsMin, "x", cfg.quantization.boundsMinX);
+            cfg.quantization.boundsMinY = getOrDefault<float>(boundsMin, "y", cfg.quantization.boundsMinY);
+            cfg.quantization.boundsMinZ = getOrDefault<float>(boundsMin, "z", cfg.quantization.boundsMinZ);
+        }
+        if (quant.contains("bounds_max") && quant["bounds_max"].is_object()) {
+            const auto& boundsMax = quant["bounds_max"];
+            cfg.quantization.boundsMaxX = getOrDefault<float>(boundsMax, "x", cfg.quantization.boundsMaxX);
+            cfg.quantization.boundsMaxY = getOrDefault<float>(boundsMax, "y", cfg.quantization.boundsMaxY);
+            cfg.quantization.boundsMaxZ = getOrDefault<float>(boundsMax, "z", cfg.quantization.boundsMaxZ);
+        }
+        cfg.quantization.positionBits = static_cast<std::uint8_t>(getOrDefault<std::uint32_t>(quant, "position_bits", cfg.quantization.positionBits));
+        cfg.quantization.yawBits = static_cast<std::uint8_t>(getOrDefault<std::uint32_t>(quant, "yaw_bits", cfg.quantization.yawBits));
+        cfg.quantization.velocityBits = static_cast<std::uint8_t>(getOrDefault<std::uint32_t>(quant, "velocity_bits", cfg.quantization.velocityBits));
+        cfg.quantization.maxSpeed = getOrDefault<float>(quant, "max_speed", cfg.quantization.maxSpeed);
+    }
+    
+    // NPC level of detail (optional, default on: full rate within 1200, 1/4 rate within 2500, asleep beyond)
+    cfg.npcSleepEnabled = getOrDefault<bool>(j, "npc_sleep_enabled", true);
+    cfg.npcActiveRadius = getOrDefault<float>(j, "npc_active_radius", 1200.0f);
+    cfg.npcWakeRadius = getOrDefault<float>(j, "npc_wake_radius", 2500.0f);
+    cfg.npcReducedTickInterval = getOrDefault<std::uint32_t>(j, "npc_reduced_tick_interval", 4);
+    
+    // NPC AI threading (optional, default off: AI runs on the simulation thread)
+    cfg.npcAiThreads = getOrDefault<std::uint32_t>(j, "npc_ai_threads", 0);
+    cfg.npcAiParallelMin = getOrDefault<std::uint32_t>(j, "npc_ai_parallel_min", 128);
+    
+    // Networking (optional, default cork_writes_during_tick=true)
+    cfg.corkWritesDuringTick = getOrDefault<bool>(j, "cork_writes_during_tick", true);
+    cfg.maxOutboundQueueBytes = getOrDefault<std::uint32_t>(j, "max_outbound_queue_bytes", 4 * 1024 * 1024);
+    cfg.slowConsumerGraceSec = getOrDefault<float>(j, "slow_consumer_grace_sec", 5.0f);
+    cfg.ioThreads = getOrDefault<std::uint32_t>(j, "io_threads", 0);
+    cfg.pingIntervalSec = getOrDefault<float>(j, "ping_interval_sec", 2.0f);
+    
+    // UDP side-channel (optional, default off)
+    cfg.udpEnabled = getOrDefault<bool>(j, "udp_enabled", false);
+    cfg.udpPort = getOrDefault<std::uint16_t>(j, "udp_port", 0);
+    cfg.udpTimeoutSec = getOrDefault<float>(j, "udp_timeout_sec", 3.0f);
+    cfg.udpSimulatedLossPercent = getOrDefault<float>(j, "udp_simulated_loss_percent", 0.0f);
+    
+    // Network stats (optional, default one summary line per minute, no file)
+    cfg.netStatsIntervalSec = getOrDefault<float>(j, "net_stats_interval_sec", 60.0f);
+    cfg.netStatsFile = getOrDefault<std::string>(j, "net_stats_file", "");
     
     // Validation
     if (cfg.moveSpeed <= 0.0f) {
@@ -311,12 +367,99 @@ ZoneConfig loadZoneConfig(const std::string& path) {
         throw std::runtime_error(msg);
     }
     
+    if (cfg.tickRateHz < 1.0f || cfg.tickRateHz > 200.0f) {
+        std::string msg = std::string{"Invalid tick_rate_hz in ZoneConfig: "} + std::to_string(cfg.tickRateHz) + " (must be 1-200)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.maxCatchUpTicks == 0) {
+        std::string msg = "Invalid max_catch_up_ticks in ZoneConfig: 0 (must be at least 1)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.tickStatsIntervalSec < 0.0f) {
+        std::string msg = std::string{"Invalid tick_stats_interval_sec in ZoneConfig: "} + std::to_string(cfg.tickStatsIntervalSec);
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
     if (cfg.interestRadius < 0.0f) {
         std::string msg = std::string{"Invalid interest_radius in ZoneConfig: "} + std::to_string(cfg.interestRadius);
         logError("Config", msg);
         throw std::runtime_error(msg);
     }
     
+    if (cfg.snapshotBaselineWindow == 0) {
+        std::string msg = "Invalid snapshot_baseline_window in ZoneConfig: 0 (must be at least 1)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.npcActiveRadius < 0.0f || cfg.npcWakeRadius < cfg.npcActiveRadius) {
+        std::string msg = std::string{"Invalid npc_active_radius/npc_wake_radius in ZoneConfig: "} +
+            std::to_string(cfg.npcActiveRadius) + "/" + std::to_string(cfg.npcWakeRadius) +
+            " (need 0 <= active <= wake)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.npcReducedTickInterval == 0) {
+        std::string msg = "Invalid npc_reduced_tick_interval in ZoneConfig: 0 (must be at least 1)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.npcAiThreads > 64) {
+        std::string msg = std::string{"Invalid npc_ai_threads in ZoneConfig: "} + std::to_string(cfg.npcAiThreads) + " (max 64)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    std::string quantizationError = protocol::validateQuantizationParams(cfg.quantization);
+    if (!quantizationError.empty()) {
+        std::string msg = std::string{"Invalid quantization in ZoneConfig: "} + quantizationError;
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.slowConsumerGraceSec < 0.0f) {
+        std::string msg = std::string{"Invalid slow_consumer_grace_sec in ZoneConfig: "} + std::to_string(cfg.slowConsumerGraceSec);
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.ioThreads > 64) {
+        std::string msg = std::string{"Invalid io_threads in ZoneConfig: "} + std::to_string(cfg.ioThreads) + " (max 64)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.pingIntervalSec < 0.0f) {
+        std::string msg = std::string{"Invalid ping_interval_sec in ZoneConfig: "} + std::to_string(cfg.pingIntervalSec);
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.udpTimeoutSec <= 0.0f) {
+        std::string msg = std::string{"Invalid udp_timeout_sec in ZoneConfig: "} + std::to_string(cfg.udpTimeoutSec);
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.udpSimulatedLossPercent < 0.0f || cfg.udpSimulatedLossPercent > 100.0f) {
+        std::string msg = std::string{"Invalid udp_simulated_loss_percent in ZoneConfig: "} + std::to_string(cfg.udpSimulatedLossPercent) + " (must be 0-100)";
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
+    if (cfg.netStatsIntervalSec < 0.0f) {
+        std::string msg = std::string{"Invalid net_stats_interval_sec in ZoneConfig: "} + std::to_string(cfg.netStatsIntervalSec);
+        logError("Config", msg);
+        throw std::runtime_error(msg);
+    }
+    
     if (cfg.zoneName.empty()) {
         std::string msg = "ZoneConfig zoneName cannot be empty";
         logError("Config", msg);
@@ -328,9 +471,33 @@ ZoneConfig loadZoneConfig(const std::string& path) {
             ", safeSpawn=(" + std::to_string(cfg.safeX) + "," + std::to_string(cfg.safeY) + "," + std::to_string(cfg.safeZ) + ")" +
             ", moveSpeed=" + std::to_string(cfg.moveSpeed) +
             ", autosaveIntervalSec=" + std::to_string(cfg.autosaveIntervalSec) +
+            ", tickRateHz=" + std::to_string(cfg.tickRateHz) +
+            ", maxCatchUpTicks=" + std::to_string(cfg.maxCatchUpTicks) +
+            ", tickStatsIntervalSec=" + std::to_string(cfg.tickStatsIntervalSec) +
             ", broadcastFullState=" + (cfg.broadcastFullState ? "true" : "false") +
             ", interestRadius=" + std::to_string(cfg.interestRadius) +
-            ", debugInterest=" + (cfg.debugInterest ? "true" : "false"));
+            ", debugInterest=" + (cfg.debugInterest ? "true" : "false") +
+            ", deltaSnapshots=" + (cfg.deltaSnapshots ? "true" : "false") +
+            ", snapshotBaselineWindow=" + std::to_string(cfg.snapshotBaselineWindow) +
+            ", quantizeState=" + (cfg.quantizeState ? "true" : "false") +
+            ", quantization=" + protocol::buildQuantizationParamsField(cfg.quantization) +
+            ", npcSleepEnabled=" + (cfg.npcSleepEnabled ? "true" : "false") +
+            ", npcActiveRadius=" + std::to_string(cfg.npcActiveRadius) +
+            ", npcWakeRadius=" + std::to_string(cfg.npcWakeRadius) +
+            ", npcReducedTickInterval=" + std::to_string(cfg.npcReducedTickInterval) +
+            ", npcAiThreads=" + std::to_string(cfg.npcAiThreads) +
+            ", npcAiParallelMin=" + std::to_string(cfg.npcAiParallelMin) +
+            ", corkWritesDuringTick=" + (cfg.corkWritesDuringTick ? "true" : "false") +
+            ", maxOutboundQueueBytes=" + std::to_string(cfg.maxOutboundQueueBytes) +
+            ", slowConsumerGraceSec=" + std::to_string(cfg.slowConsumerGraceSec) +
+            ", ioThreads=" + std::to_string(cfg.ioThreads) +
+            ", pingIntervalSec=" + std::to_string(cfg.pingIntervalSec) +
+            ", udpEnabled=" + (cfg.udpEnabled ? "true" : "false") +
+            ", udpPort=" + std::to_string(cfg.udpPort) +
+            ", udpTimeoutSec=" + std::to_string(cfg.udpTimeoutSec) +
+            ", udpSimulatedLossPercent=" + std::to_string(cfg.udpSimulatedLossPercent) +
+            ", netStatsIntervalSec=" + std::to_string(cfg.netStatsIntervalSec) +
+            ", netStatsFile=" + (cfg.netStatsFile.empty() ? "(none)" : cfg.netStatsFile));
     
     return cfg;
 }
@@ -1,12 +1,18 @@
 #include "../include/req/shared/Connection.h"
 #include "../include/req/shared/MessageHeader.h"
+#include "../include/req/shared/MessageBundle.h"
 
-#include <array>
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 namespace req::shared::net {
 
 Connection::Connection(Tcp::socket socket)
     : socket_(std::move(socket)) {
+    boost::system::error_code ec;
+    auto endpoint = socket_.remote_endpoint(ec);
+    remoteAddress_ = ec ? std::string{ "unknown" } : endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
 }
 
 void Connection::setMessageHandler(MessageHandler handler) {
@@ -19,7 +25,13 @@ void Connection::setDisconnectHandler(DisconnectHandler handler) {
 
 void Connection::start() {
     req::shared::logInfo("net", "Connection started");
-    doReadHeader();
+    if (metrics_) {
+        metrics_->recordConnectionOpened();
+    }
+    auto self = shared_from_this();
+    boost::asio::dispatch(socket_.get_executor(), [self]() {
+        self->doReadHeader();
+    });
 }
 
 void Connection::doReadHeader() {
@@ -56,14 +68,24 @@ void Connection::doReadHeader() {
                 // For now, continue processing the message
             }
 
+            if (self->incomingHeader_.payloadSize > MaxInboundPayloadBytes) {
+                req::shared::logWarn("net", std::string{"Inbound payload too large: "} +
+                    std::to_string(self->incomingHeader_.payloadSize) + " bytes (max " +
+                    std::to_string(MaxInboundPayloadBytes) + ")");
+                self->closeInternal("inbound payload too large");
+                return;
+            }
+
             if (self->incomingHeader_.payloadSize > 0) {
-                self->incomingBody_.resize(self->incomingHeader_.payloadSize);
+                // Reuse the pooled buffer; only grow when a larger payload arrives
+                if (self->incomingBody_.size() < self->incomingHeader_.payloadSize) {
+                    self->incomingBody_.resize(self->incomingHeader_.payloadSize);
+                }
                 self->doReadBody();
             } else {
-                if (self->onMessage_) {
-                    self->onMessage_(self->incomingHeader_, self->incomingBody_, self);
-                } else {
-                    req::shared::logWarn("net", "Message received but no handler installed (empty body)");
+                self->dispatchMessage();
+                if (self->closed_) {
+                    return;
                 }
                 self->doReadHeader();
             }
@@ -75,7 +97,7 @@ void Connection::doReadBody() {
     auto self = shared_from_this();
     boost::asio::async_read(
         socket_,
-        boost::asio::buffer(self->incomingBody_.data(), self->incomingBody_.size()),
+        boost::asio::buffer(self->incomingBody_.data(), self->incomingHeader_.payloadSize),
         [self](boost::system::error_code ec, std::size_t bytes) {
             if (ec) {
                 if (ec == boost::asio::error::eof) {
@@ -88,55 +110,335 @@ void Connection::doReadBody() {
                 self->closeInternal("read body error: " + ec.message());
                 return;
             }
-            if (bytes != self->incomingBody_.size()) {
+            if (bytes != self->incomingHeader_.payloadSize) {
                 req::shared::logWarn("net", "Partial body read; closing connection");
                 self->closeInternal("partial body read");
                 return;
             }
 
-            if (self->onMessage_) {
-                self->onMessage_(self->incomingHeader_, self->incomingBody_, self);
-            } else {
-                req::shared::logWarn("net", "Message received but no handler installed (body)");
+            self->dispatchMessage();
+            if (self->closed_) {
+                return;
             }
             self->doReadHeader();
         }
     );
 }
 
+void Connection::dispatchMessage() {
+    std::string_view payload(reinterpret_cast<const char*>(incomingBody_.data()), incomingHeader_.payloadSize);
+
+    if (incomingHeader_.type == req::shared::MessageType::MessageBundle) {
+        dispatchBundle(payload);
+    } else if (onMessage_) {
+        recordReceived(incomingHeader_.type, sizeof(incomingHeader_) + payload.size());
+        onMessage_(incomingHeader_, payload, shared_from_this());
+    } else {
+        req::shared::logWarn("net", "Message received but no handler installed");
+    }
+
+    // Don't let one oversized message pin a large buffer for the connection's lifetime
+    if (incomingBody_.size() > RetainedReadBufferBytes) {
+        ByteArray().swap(incomingBody_);
+    }
+}
+
+void Connection::dispatchBundle(std::string_view bundle) {
+    if (!onMessage_) {
+        req::shared::logWarn("net", "Message bundle received but no handler installed");
+        return;
+    }
+
+    // Each entry is delivered as if it had arrived in its own frame
+    req::shared::MessageHeader entryHeader = incomingHeader_;
+    entryHeader.reserved = 0;
+    auto self = shared_from_this();
+    bool valid = req::shared::forEachBundleEntry(bundle,
+        [&](req::shared::MessageType type, std::string_view payload) {
+            if (closed_) {
+                return;  // A handler closed the connection; drop the rest
+            }
+            entryHeader.type = type;
+            entryHeader.payloadSize = static_cast<std::uint32_t>(payload.size());
+            recordReceived(type, sizeof(entryHeader) + payload.size());
+            onMessage_(entryHeader, payload, self);
+        });
+
+    if (!valid && !closed_) {
+        req::shared::logWarn("net", std::string{"Malformed message bundle ("} +
+            std::to_string(bundle.size()) + " bytes); closing connection");
+        closeInternal("malformed message bundle");
+    }
+}
+
+void Connection::recordReceived(req::shared::MessageType type, std::size_t bytes) {
+    counters_.messagesReceived.fetch_add(1, std::memory_order_relaxed);
+    counters_.bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+    if (metrics_) {
+        metrics_->recordReceived(type, bytes);
+    }
+}
+
+namespace {
+    Connection::SharedFrame buildFrame(req::shared::MessageType type,
+                                       const std::uint8_t* payload,
+                                       std::size_t payloadSize,
+                                       std::uint64_t reserved) {
+        req::shared::MessageHeader header;
+        header.protocolVersion = req::shared::CurrentProtocolVersion; // Set protocol version on send
+        header.type = type;
+        header.payloadSize = static_cast<std::uint32_t>(payloadSize);
+        header.reserved = reserved;
+
+        auto frame = std::make_shared<Connection::ByteArray>(sizeof(header) + payloadSize);
+        std::memcpy(frame->data(), &header, sizeof(header));
+        if (payloadSize > 0) {
+            std::memcpy(frame->data() + sizeof(header), payload, payloadSize);
+        }
+        return frame;
+    }
+
+    req::shared::MessageHeader frameHeader(const Connection::ByteArray& frame) {
+        req::shared::MessageHeader header;
+        std::memcpy(&header, frame.data(), sizeof(header));
+        return header;
+    }
+
+    // Snapshot-class messages: only the newest unsent one is worth delivering
+    bool isSupersedable(req::shared::MessageType type) {
+        return type == req::shared::MessageType::PlayerStateSnapshot ||
+            type == req::shared::MessageType::PlayerStateDelta;
+    }
+}
+
+Connection::SharedFrame Connection::makeFrame(req::shared::MessageType type, const ByteArray& payload, std::uint64_t reserved) {
+    return buildFrame(type, payload.data(), payload.size(), reserved);
+}
+
+Connection::SharedFrame Connection::makeFrame(req::shared::MessageType type, const std::string& payload, std::uint64_t reserved) {
+    return buildFrame(type, reinterpret_cast<const std::uint8_t*>(payload.data()), payload.size(), reserved);
+}
+
 void Connection::send(req::shared::MessageType type, const ByteArray& payload, std::uint64_t reserved) {
-    OutgoingMessage msg;
-    msg.header.protocolVersion = req::shared::CurrentProtocolVersion; // Set protocol version on send
-    msg.header.type = type;
-    msg.header.payloadSize = static_cast<std::uint32_t>(payload.size());
-    msg.header.reserved = reserved;
-    msg.body = payload;
+    send(makeFrame(type, payload, reserved));
+}
+
+void Connection::send(const SharedFrame& frame) {
+    if (!frame || frame->size() < sizeof(req::shared::MessageHeader) || closed_) {
+        return;
+    }
 
-    writeQueue_.push_back(std::move(msg));
-    if (!writeInProgress_) {
-        doWrite();
+    auto header = frameHeader(*frame);
+    auto type = header.type;
+
+    std::unique_lock<std::mutex> lock(writeMutex_);
+
+    // Drop an older snapshot that hasn't been handed to the socket yet.
+    // Frames [0, writeInFlightCount_) belong to the current async_write.
+    if (isSupersedable(type)) {
+        for (auto it = writeQueue_.begin() + static_cast<std::ptrdiff_t>(writeInFlightCount_); it != writeQueue_.end(); ++it) {
+            if (it->type == type) {
+                bytesPending_ -= it->frame->size();
+                writeQueue_.erase(it);
+                counters_.snapshotsSuperseded.fetch_add(1, std::memory_order_relaxed);
+                if (metrics_) {
+                    metrics_->recordSnapshotSuperseded();
+                }
+                break;
+            }
+        }
     }
+
+    bytesPending_ += frame->size();
+    // Bundle entries don't carry 'reserved', so only frames that leave it zero qualify
+    bool bundleable = bundlingEnabled_ && header.reserved == 0 &&
+        type != req::shared::MessageType::MessageBundle &&
+        header.payloadSize <= req::shared::MaxBundledPayloadBytes;
+    writeQueue_.push_back(OutgoingMessage{ frame, type, bundleable, std::chrono::steady_clock::now() });
+    if (writeQueue_.size() > queueDepthHighWater_) {
+        queueDepthHighWater_ = writeQueue_.size();
+        if (metrics_) {
+            metrics_->recordQueueDepth(queueDepthHighWater_);
+        }
+    }
+
+    enforceQueueLimits();
+
+    if (!writeInProgress_ && !corked_) {
+        writeInProgress_ = true;
+        lock.unlock();
+        startWrite();
+    }
+}
+
+void Connection::enforceQueueLimits() {
+    if (queueLimits_.maxPendingBytes == 0 || bytesPending_ <= queueLimits_.maxPendingBytes) {
+        overQueueLimit_ = false;
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (!overQueueLimit_) {
+        overQueueLimit_ = true;
+        overQueueLimitSince_ = now;
+        req::shared::logWarn("net", std::string{"Outbound queue over limit: depth="} +
+            std::to_string(writeQueue_.size()) + ", bytesPending=" + std::to_string(bytesPending_) +
+            ", limit=" + std::to_string(queueLimits_.maxPendingBytes));
+        return;
+    }
+
+    if (now - overQueueLimitSince_ >= queueLimits_.slowConsumerGrace && !slowConsumerClosePending_) {
+        // send() is usually called from inside a broadcast loop over the owner's
+        // connection list; close from a posted handler so the disconnect
+        // callback never runs re-entrantly inside that loop.
+        slowConsumerClosePending_ = true;
+        std::string reason = "slow consumer (bytesPending=" + std::to_string(bytesPending_) +
+            " over limit " + std::to_string(queueLimits_.maxPendingBytes) + " for " +
+            std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(now - overQueueLimitSince_).count()) + "ms)";
+        auto self = shared_from_this();
+        boost::asio::post(socket_.get_executor(), [self, reason]() {
+            self->closeInternal(reason);
+        });
+    }
+}
+
+void Connection::setCorked(bool corked) {
+    std::unique_lock<std::mutex> lock(writeMutex_);
+    corked_ = corked;
+    if (!corked_ && !writeInProgress_ && !writeQueue_.empty() && !closed_) {
+        writeInProgress_ = true;
+        lock.unlock();
+        startWrite();
+    }
+}
+
+void Connection::setBundlingEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    bundlingEnabled_ = enabled;
+}
+
+bool Connection::isCorked() const {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    return corked_;
+}
+
+std::size_t Connection::queueDepth() const {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    return writeQueue_.size();
+}
+
+std::size_t Connection::bytesPending() const {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    return bytesPending_;
+}
+
+Connection::Stats Connection::getStats() const {
+    Stats stats;
+    stats.messagesSent = counters_.messagesSent.load(std::memory_order_relaxed);
+    stats.bytesSent = counters_.bytesSent.load(std::memory_order_relaxed);
+    stats.messagesReceived = counters_.messagesReceived.load(std::memory_order_relaxed);
+    stats.bytesReceived = counters_.bytesReceived.load(std::memory_order_relaxed);
+    stats.writes = counters_.writes.load(std::memory_order_relaxed);
+    stats.wireBytesWritten = counters_.wireBytesWritten.load(std::memory_order_relaxed);
+    stats.bundlesSent = counters_.bundlesSent.load(std::memory_order_relaxed);
+    stats.snapshotsSuperseded = counters_.snapshotsSuperseded.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        stats.queueDepth = writeQueue_.size();
+        stats.queueDepthHighWater = queueDepthHighWater_;
+        stats.bytesPending = bytesPending_;
+    }
+    stats.writeLatencyP50 = writeLatency_.percentile(0.50);
+    stats.writeLatencyP99 = writeLatency_.percentile(0.99);
+    stats.writeLatencyMax = writeLatency_.max();
+    return stats;
+}
+
+void Connection::startWrite() {
+    auto self = shared_from_this();
+    boost::asio::dispatch(socket_.get_executor(), [self]() {
+        self->doWrite();
+    });
 }
 
 void Connection::doWrite() {
-    if (writeQueue_.empty()) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    if (writeQueue_.empty() || closed_) {
         writeInProgress_ = false;
         return;
     }
 
-    writeInProgress_ = true;
-    auto& front = writeQueue_.front();
-
-    std::array<boost::asio::const_buffer, 2> buffers = {
-        boost::asio::buffer(&front.header, sizeof(front.header)),
-        boost::asio::buffer(front.body.data(), front.body.size())
+    // Gather as many queued frames as fit into one write. The first frame is
+    // always included so oversized messages still go out. Consecutive
+    // bundleable frames form a run that is sent as one MessageBundle.
+    struct Run {
+        std::size_t first;         // Index into writeQueue_
+        std::size_t count;
+        std::size_t bundleBytes;   // Bundle payload size if the run is packed
     };
+    std::vector<Run> runs;
+    runs.reserve(std::min(writeQueue_.size(), MaxGatherBuffers));
+    std::size_t gatheredBytes = 0;
+    std::size_t gatheredCount = 0;
+    for (const auto& msg : writeQueue_) {
+        std::size_t frameBytes = msg.frame->size();
+        std::size_t entryBytes = req::shared::BundleEntryHeaderBytes + frameBytes - sizeof(req::shared::MessageHeader);
+        if (!runs.empty() && gatheredBytes + frameBytes > MaxGatherBytes) {
+            break;
+        }
+        Run* last = runs.empty() ? nullptr : &runs.back();
+        if (msg.bundleable && last && writeQueue_[last->first].bundleable &&
+            last->bundleBytes + entryBytes <= req::shared::MaxBundlePayloadBytes) {
+            last->count++;
+            last->bundleBytes += entryBytes;
+        } else {
+            if (runs.size() >= MaxGatherBuffers) {
+                break;
+            }
+            runs.push_back(Run{ gatheredCount, 1, entryBytes });
+        }
+        gatheredBytes += frameBytes;
+        ++gatheredCount;
+    }
+    writeInFlightCount_ = gatheredCount;
+
+    // Bundles are built here (not at send time) so snapshot supersession in
+    // send() still sees individual frames until they are handed to the socket
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(runs.size());
+    std::shared_ptr<std::vector<ByteArray>> bundles;
+    for (const auto& run : runs) {
+        if (run.count == 1) {
+            const auto& frame = *writeQueue_[run.first].frame;
+            buffers.emplace_back(frame.data(), frame.size());
+            continue;
+        }
+        if (!bundles) {
+            bundles = std::make_shared<std::vector<ByteArray>>();
+            bundles->reserve(runs.size());
+        }
+        ByteArray& bundle = bundles->emplace_back();
+        bundle.reserve(sizeof(req::shared::MessageHeader) + run.bundleBytes);
+        bundle.resize(sizeof(req::shared::MessageHeader));
+        for (std::size_t i = run.first; i < run.first + run.count; ++i) {
+            const auto& frame = *writeQueue_[i].frame;
+            req::shared::appendBundleEntry(bundle, writeQueue_[i].type,
+                frame.data() + sizeof(req::shared::MessageHeader),
+                frame.size() - sizeof(req::shared::MessageHeader));
+        }
+        req::shared::MessageHeader header;
+        header.protocolVersion = req::shared::CurrentProtocolVersion;
+        header.type = req::shared::MessageType::MessageBundle;
+        header.payloadSize = static_cast<std::uint32_t>(bundle.size() - sizeof(header));
+        std::memcpy(bundle.data(), &header, sizeof(header));
+        buffers.emplace_back(bundle.data(), bundle.size());
+    }
 
     auto self = shared_from_this();
     boost::asio::async_write(
         socket_,
         buffers,
-        [self](boost::system::error_code ec, std::size_t /*bytes*/) {
+        [self, bundles](boost::system::error_code ec, std::size_t bytes) {
             if (ec) {
                 if (ec == boost::asio::error::eof) {
                     req::shared::logInfo("net", "Connection closed by peer during write");
@@ -148,28 +450,64 @@ void Connection::doWrite() {
                 self->closeInternal("write error: " + ec.message());
                 return;
             }
-            self->writeQueue_.pop_front();
-            if (!self->writeQueue_.empty()) {
+            std::size_t bundleCount = bundles ? bundles->size() : 0;
+            self->counters_.writes.fetch_add(1, std::memory_order_relaxed);
+            self->counters_.wireBytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+            self->counters_.bundlesSent.fetch_add(bundleCount, std::memory_order_relaxed);
+            if (self->metrics_) {
+                self->metrics_->recordWrite(bytes, bundleCount);
+            }
+
+            bool more = false;
+            {
+                auto now = std::chrono::steady_clock::now();
+                std::lock_guard<std::mutex> lock(self->writeMutex_);
+                for (std::size_t i = 0; i < self->writeInFlightCount_ && !self->writeQueue_.empty(); ++i) {
+                    const auto& msg = self->writeQueue_.front();
+                    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - msg.enqueuedAt);
+                    self->counters_.messagesSent.fetch_add(1, std::memory_order_relaxed);
+                    self->counters_.bytesSent.fetch_add(msg.frame->size(), std::memory_order_relaxed);
+                    self->writeLatency_.record(latency);
+                    if (self->metrics_) {
+                        self->metrics_->recordSent(msg.type, msg.frame->size());
+                        self->metrics_->recordWriteLatency(latency);
+                    }
+                    self->bytesPending_ -= msg.frame->size();
+                    self->writeQueue_.pop_front();
+                }
+                self->writeInFlightCount_ = 0;
+                if (self->overQueueLimit_ && self->bytesPending_ <= self->queueLimits_.maxPendingBytes) {
+                    self->overQueueLimit_ = false;
+                }
+                more = !self->writeQueue_.empty() && !self->corked_;
+                if (!more) {
+                    self->writeInProgress_ = false;
+                }
+            }
+            if (more) {
                 self->doWrite();
-            } else {
-                self->writeInProgress_ = false;
             }
         }
     );
 }
 
 void Connection::close() {
-    closeInternal("explicit close() call");
+    auto self = shared_from_this();
+    boost::asio::dispatch(socket_.get_executor(), [self]() {
+        self->closeInternal("explicit close() call");
+    });
 }
 
 void Connection::closeInternal(const std::string& reason) {
     // Prevent double-close
-    if (closed_) {
+    if (closed_.exchange(true)) {
         return;
     }
-    closed_ = true;
     
     req::shared::logInfo("net", std::string{"[DISCONNECT] Connection closing: reason="} + reason);
+    if (metrics_) {
+        metrics_->recordDisconnect(reason);
+    }
     
     // Cancel any pending async operations
     boost::system::error_code ec;
@@ -0,0 +1,322 @@
+#include "../include/req/shared/MotionKernel.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define REQ_MOTION_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace req::shared {
+
+// ============================================================================
+// MotionTable
+// ============================================================================
+
+std::uint32_t MotionTable::add(std::uint64_t id) {
+    auto slot = static_cast<std::uint32_t>(ids.size());
+    ids.push_back(id);
+    for (auto* column : { &posX, &posY, &posZ, &velX, &velY, &velZ,
+                          &lastValidX, &lastValidY, &lastValidZ, &inputX, &inputY, &moveDist }) {
+        column->push_back(0.0f);
+    }
+    jump.push_back(0);
+    enabled.push_back(0);
+    flags.push_back(0);
+    return slot;
+}
+
+std::uint64_t MotionTable::remove(std::uint32_t slot) {
+    if (slot >= ids.size()) {
+        return 0;
+    }
+
+    std::size_t last = ids.size() - 1;
+    auto moveLast = [slot, last](auto& column) {
+        column[slot] = column[last];
+        column.pop_back();
+    };
+    moveLast(ids);
+    for (auto* column : { &posX, &posY, &posZ, &velX, &velY, &velZ,
+                          &lastValidX, &lastValidY, &lastValidZ, &inputX, &inputY, &moveDist }) {
+        moveLast(*column);
+    }
+    moveLast(jump);
+    moveLast(enabled);
+    moveLast(flags);
+    return slot < ids.size() ? ids[slot] : 0;
+}
+
+void MotionTable::clear() {
+    ids.clear();
+    for (auto* column : { &posX, &posY, &posZ, &velX, &velY, &velZ,
+                          &lastValidX, &lastValidY, &lastValidZ, &inputX, &inputY, &moveDist }) {
+        column->clear();
+    }
+    jump.clear();
+    enabled.clear();
+    flags.clear();
+}
+
+namespace {
+    // Raw column pointers for the kernels. Stores through std::vector's
+    // operator[] (and the may-alias SSE store types) would otherwise make the
+    // compiler reload every vector's data pointer after each write.
+    struct MotionColumns {
+        explicit MotionColumns(MotionTable& t)
+            : posX(t.posX.data()), posY(t.posY.data()), posZ(t.posZ.data()),
+              velX(t.velX.data()), velY(t.velY.data()), velZ(t.velZ.data()),
+              lastValidX(t.lastValidX.data()), lastValidY(t.lastValidY.data()), lastValidZ(t.lastValidZ.data()),
+              inputX(t.inputX.data()), inputY(t.inputY.data()),
+              jump(t.jump.data()), enabled(t.enabled.data()),
+              moveDist(t.moveDist.data()), flags(t.flags.data()) {}
+
+        float* posX; float* posY; float* posZ;
+        float* velX; float* velY; float* velZ;
+        float* lastValidX; float* lastValidY; float* lastValidZ;
+        const float* inputX; const float* inputY;
+        const std::uint8_t* jump; const std::uint8_t* enabled;
+        float* moveDist; std::uint8_t* flags;
+    };
+}
+
+// ============================================================================
+// Scalar reference
+// ============================================================================
+
+void integrateMotionScalar(MotionTable& t, const MotionParams& p, std::size_t firstRow) {
+    const float maxAllowedMove = p.moveSpeed * p.dt * p.maxAllowedMoveMultiplier;
+    const float suspiciousThreshold = maxAllowedMove * p.suspiciousMoveMultiplier;
+    const float gravityStep = p.gravity * p.dt;
+    MotionColumns c(t);
+
+    for (std::size_t i = firstRow; i < t.size(); ++i) {
+        if (!c.enabled[i]) {
+            c.flags[i] = 0;
+            c.moveDist[i] = 0.0f;
+            continue;
+        }
+
+        std::uint8_t flags = 0;
+
+        // Normalize diagonal movement
+        float dirX = c.inputX[i];
+        float dirY = c.inputY[i];
+        float inputLength = std::sqrt(dirX * dirX + dirY * dirY);
+        if (inputLength > 1.0f) {
+            dirX = dirX / inputLength;
+            dirY = dirY / inputLength;
+        }
+        float velX = dirX * p.moveSpeed;
+        float velY = dirY * p.moveSpeed;
+
+        // Jump from the ground, gravity in the air
+        float velZ = c.velZ[i];
+        if (c.posZ[i] <= p.groundLevel) {
+            if (c.jump[i]) {
+                velZ = p.jumpVelocity;
+                flags |= MotionFlag::Jumped;
+            } else {
+                velZ = 0.0f;
+            }
+        } else {
+            velZ = velZ + gravityStep;
+        }
+
+        float newX = c.posX[i] + velX * p.dt;
+        float newY = c.posY[i] + velY * p.dt;
+        float newZ = c.posZ[i] + velZ * p.dt;
+        if (newZ <= p.groundLevel) {
+            newZ = p.groundLevel;
+            velZ = 0.0f;
+        }
+
+        // Sanity check against the last accepted position
+        float dx = newX - c.lastValidX[i];
+        float dy = newY - c.lastValidY[i];
+        float dz = newZ - c.lastValidZ[i];
+        float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (dist > suspiciousThreshold) {
+            newX = c.lastValidX[i];
+            newY = c.lastValidY[i];
+            newZ = c.lastValidZ[i];
+            velX = 0.0f;
+            velY = 0.0f;
+            velZ = 0.0f;
+            flags |= MotionFlag::SnappedBack;
+        } else {
+            c.lastValidX[i] = newX;
+            c.lastValidY[i] = newY;
+            c.lastValidZ[i] = newZ;
+            if (dist > 0.01f) {
+                flags |= MotionFlag::Dirty;
+            }
+        }
+
+        if (newX != c.posX[i] || newY != c.posY[i] || newZ != c.posZ[i] ||
+            velX != c.velX[i] || velY != c.velY[i] || velZ != c.velZ[i]) {
+            flags |= MotionFlag::Moved;
+        }
+
+        c.posX[i] = newX;
+        c.posY[i] = newY;
+        c.posZ[i] = newZ;
+        c.velX[i] = velX;
+        c.velY[i] = velY;
+        c.velZ[i] = velZ;
+        c.moveDist[i] = dist;
+        c.flags[i] = flags;
+    }
+}
+
+// ============================================================================
+// SSE2 kernel
+// ============================================================================
+
+#ifdef REQ_MOTION_SSE2
+
+namespace {
+    inline __m128 select(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+        return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    }
+
+    // Four 0/1 bytes -> four all-ones/all-zero lanes
+    inline __m128 byteMask(const std::uint8_t* bytes) {
+        std::int32_t packed;
+        std::memcpy(&packed, bytes, sizeof(packed));
+        __m128i lanes = _mm_cvtsi32_si128(packed);
+        lanes = _mm_unpacklo_epi8(lanes, _mm_setzero_si128());
+        lanes = _mm_unpacklo_epi16(lanes, _mm_setzero_si128());
+        return _mm_castsi128_ps(_mm_cmpgt_epi32(lanes, _mm_setzero_si128()));
+    }
+
+    // Lane masks -> one MotionFlag byte per lane
+    inline void storeFlags(std::uint8_t* out, __m128 moved, __m128 dirty, __m128 snapped, __m128 jumped) {
+        __m128i bits = _mm_or_si128(
+            _mm_or_si128(_mm_and_si128(_mm_castps_si128(moved), _mm_set1_epi32(MotionFlag::Moved)),
+                         _mm_and_si128(_mm_castps_si128(dirty), _mm_set1_epi32(MotionFlag::Dirty))),
+            _mm_or_si128(_mm_and_si128(_mm_castps_si128(snapped), _mm_set1_epi32(MotionFlag::SnappedBack)),
+                         _mm_and_si128(_mm_castps_si128(jumped), _mm_set1_epi32(MotionFlag::Jumped))));
+        bits = _mm_packs_epi32(bits, bits);
+        bits = _mm_packus_epi16(bits, bits);
+        std::int32_t packed = _mm_cvtsi128_si32(bits);
+        std::memcpy(out, &packed, sizeof(packed));
+    }
+
+    // Returns the number of rows handled (a multiple of 4)
+    std::size_t integrateMotionSse2(MotionTable& t, const MotionParams& p) {
+        const float maxAllowedMove = p.moveSpeed * p.dt * p.maxAllowedMoveMultiplier;
+        const __m128 suspiciousThreshold = _mm_set1_ps(maxAllowedMove * p.suspiciousMoveMultiplier);
+        const __m128 gravityStep = _mm_set1_ps(p.gravity * p.dt);
+        const __m128 dt = _mm_set1_ps(p.dt);
+        const __m128 moveSpeed = _mm_set1_ps(p.moveSpeed);
+        const __m128 jumpVelocity = _mm_set1_ps(p.jumpVelocity);
+        const __m128 ground = _mm_set1_ps(p.groundLevel);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 dirtyDist = _mm_set1_ps(0.01f);
+        MotionColumns c(t);
+
+        std::size_t rows = t.size() & ~std::size_t{ 3 };
+        for (std::size_t i = 0; i < rows; i += 4) {
+            const __m128 enabled = byteMask(&c.enabled[i]);
+            const __m128 jump = byteMask(&c.jump[i]);
+
+            const __m128 posX = _mm_loadu_ps(&c.posX[i]);
+            const __m128 posY = _mm_loadu_ps(&c.posY[i]);
+            const __m128 posZ = _mm_loadu_ps(&c.posZ[i]);
+            const __m128 oldVelX = _mm_loadu_ps(&c.velX[i]);
+            const __m128 oldVelY = _mm_loadu_ps(&c.velY[i]);
+            const __m128 oldVelZ = _mm_loadu_ps(&c.velZ[i]);
+            const __m128 lastX = _mm_loadu_ps(&c.lastValidX[i]);
+            const __m128 lastY = _mm_loadu_ps(&c.lastValidY[i]);
+            const __m128 lastZ = _mm_loadu_ps(&c.lastValidZ[i]);
+
+            // Normalize diagonal movement
+            __m128 dirX = _mm_loadu_ps(&c.inputX[i]);
+            __m128 dirY = _mm_loadu_ps(&c.inputY[i]);
+            __m128 inputLength = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dirX, dirX), _mm_mul_ps(dirY, dirY)));
+            __m128 tooLong = _mm_cmpgt_ps(inputLength, one);
+            dirX = select(tooLong, _mm_div_ps(dirX, inputLength), dirX);
+            dirY = select(tooLong, _mm_div_ps(dirY, inputLength), dirY);
+            __m128 velX = _mm_mul_ps(dirX, moveSpeed);
+            __m128 velY = _mm_mul_ps(dirY, moveSpeed);
+
+            // Jump from the ground, gravity in the air
+            __m128 onGround = _mm_cmple_ps(posZ, ground);
+            __m128 jumped = _mm_and_ps(onGround, jump);
+            __m128 velZ = select(onGround, _mm_and_ps(jump, jumpVelocity), _mm_add_ps(oldVelZ, gravityStep));
+
+            __m128 newX = _mm_add_ps(posX, _mm_mul_ps(velX, dt));
+            __m128 newY = _mm_add_ps(posY, _mm_mul_ps(velY, dt));
+            __m128 newZ = _mm_add_ps(posZ, _mm_mul_ps(velZ, dt));
+            __m128 landed = _mm_cmple_ps(newZ, ground);
+            newZ = select(landed, ground, newZ);
+            velZ = _mm_andnot_ps(landed, velZ);
+
+            // Sanity check against the last accepted position
+            __m128 dx = _mm_sub_ps(newX, lastX);
+            __m128 dy = _mm_sub_ps(newY, lastY);
+            __m128 dz = _mm_sub_ps(newZ, lastZ);
+            __m128 dist = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+            __m128 snapped = _mm_cmpgt_ps(dist, suspiciousThreshold);
+            newX = select(snapped, lastX, newX);
+            newY = select(snapped, lastY, newY);
+            newZ = select(snapped, lastZ, newZ);
+            velX = _mm_andnot_ps(snapped, velX);
+            velY = _mm_andnot_ps(snapped, velY);
+            velZ = _mm_andnot_ps(snapped, velZ);
+            __m128 dirty = _mm_andnot_ps(snapped, _mm_cmpgt_ps(dist, dirtyDist));
+
+            // Disabled rows keep their state
+            newX = select(enabled, newX, posX);
+            newY = select(enabled, newY, posY);
+            newZ = select(enabled, newZ, posZ);
+            velX = select(enabled, velX, oldVelX);
+            velY = select(enabled, velY, oldVelY);
+            velZ = select(enabled, velZ, oldVelZ);
+            __m128 accepted = _mm_andnot_ps(snapped, enabled);
+
+            __m128 moved = _mm_or_ps(_mm_or_ps(_mm_cmpneq_ps(newX, posX), _mm_cmpneq_ps(newY, posY)),
+                                     _mm_cmpneq_ps(newZ, posZ));
+            moved = _mm_or_ps(moved, _mm_or_ps(_mm_or_ps(_mm_cmpneq_ps(velX, oldVelX), _mm_cmpneq_ps(velY, oldVelY)),
+                                               _mm_cmpneq_ps(velZ, oldVelZ)));
+
+            _mm_storeu_ps(&c.posX[i], newX);
+            _mm_storeu_ps(&c.posY[i], newY);
+            _mm_storeu_ps(&c.posZ[i], newZ);
+            _mm_storeu_ps(&c.velX[i], velX);
+            _mm_storeu_ps(&c.velY[i], velY);
+            _mm_storeu_ps(&c.velZ[i], velZ);
+            _mm_storeu_ps(&c.lastValidX[i], select(accepted, newX, lastX));
+            _mm_storeu_ps(&c.lastValidY[i], select(accepted, newY, lastY));
+            _mm_storeu_ps(&c.lastValidZ[i], select(accepted, newZ, lastZ));
+            _mm_storeu_ps(&c.moveDist[i], _mm_and_ps(enabled, dist));
+
+            storeFlags(&c.flags[i], _mm_and_ps(enabled, moved), _mm_and_ps(enabled, dirty),
+                       _mm_and_ps(enabled, snapped), _mm_and_ps(enabled, jumped));
+        }
+        return rows;
+    }
+}
+
+#endif
+
+void integrateMotion(MotionTable& table, const MotionParams& params) {
+#ifdef REQ_MOTION_SSE2
+    std::size_t done = integrateMotionSse2(table, params);
+    integrateMotionScalar(table, params, done);
+#else
+    integrateMotionScalar(table, params);
+#endif
+}
+
+bool motionKernelIsVectorized() {
+#ifdef REQ_MOTION_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace req::shared
@@ -0,0 +1,201 @@
+#include "../include/req/shared/NetMetrics.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+
+namespace req::shared::net {
+
+// ============================================================================
+// LatencyHistogram
+// ============================================================================
+
+void LatencyHistogram::record(std::chrono::microseconds latency) {
+    auto us = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+    // Bucket i holds [2^(i-1), 2^i) us; bucket 0 holds 0 us
+    std::size_t bucket = std::min<std::size_t>(static_cast<std::size_t>(std::bit_width(us)), BucketCount - 1);
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+
+    auto value = static_cast<std::int64_t>(us);
+    auto currentMax = maxUs_.load(std::memory_order_relaxed);
+    while (value > currentMax && !maxUs_.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+    }
+}
+
+std::chrono::microseconds LatencyHistogram::percentile(double p) const {
+    std::uint64_t total = count();
+    if (total == 0) {
+        return std::chrono::microseconds(0);
+    }
+
+    auto target = static_cast<std::uint64_t>(std::clamp(p, 0.0, 1.0) * static_cast<double>(total));
+    target = std::max<std::uint64_t>(target, 1);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BucketCount; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            if (i == BucketCount - 1) {
+                return max();
+            }
+            return std::chrono::microseconds(std::min<std::int64_t>(std::int64_t{ 1 } << i, maxUs_.load(std::memory_order_relaxed)));
+        }
+    }
+    return max();
+}
+
+std::string LatencyHistogram::summary() const {
+    return "n=" + std::to_string(count()) +
+        " p50<=" + std::to_string(percentile(0.50).count()) + "us" +
+        " p90<=" + std::to_string(percentile(0.90).count()) + "us" +
+        " p99<=" + std::to_string(percentile(0.99).count()) + "us" +
+        " max=" + std::to_string(max().count()) + "us";
+}
+
+// ============================================================================
+// NetMetrics
+// ============================================================================
+
+std::size_t NetMetrics::slotFor(MessageType type) {
+    return std::min<std::size_t>(static_cast<std::size_t>(type), TrackedMessageTypes - 1);
+}
+
+void NetMetrics::recordSent(MessageType type, std::size_t bytes) {
+    auto& counters = types_[slotFor(type)];
+    counters.messagesSent.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesSent.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void NetMetrics::recordReceived(MessageType type, std::size_t bytes) {
+    auto& counters = types_[slotFor(type)];
+    counters.messagesReceived.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void NetMetrics::recordWrite(std::size_t wireBytes, std::size_t bundles) {
+    writes_.fetch_add(1, std::memory_order_relaxed);
+    wireBytesWritten_.fetch_add(wireBytes, std::memory_order_relaxed);
+    bundlesSent_.fetch_add(bundles, std::memory_order_relaxed);
+}
+
+void NetMetrics::recordWriteLatency(std::chrono::microseconds latency) {
+    writeLatency_.record(latency);
+}
+
+void NetMetrics::recordQueueDepth(std::size_t depth) {
+    auto currentMax = queueDepthHighWater_.load(std::memory_order_relaxed);
+    while (depth > currentMax && !queueDepthHighWater_.compare_exchange_weak(currentMax, depth, std::memory_order_relaxed)) {
+    }
+}
+
+void NetMetrics::recordRtt(std::chrono::microseconds rtt) {
+    rtt_.record(rtt);
+}
+
+void NetMetrics::recordSnapshotSuperseded() {
+    snapshotsSuperseded_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NetMetrics::recordConnectionOpened() {
+    connectionsOpened_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NetMetrics::recordDisconnect(std::string_view reason) {
+    connectionsClosed_.fetch_add(1, std::memory_order_relaxed);
+
+    // Reasons carry details in a trailing "(...)"; group by the part before it
+    auto key = reason.substr(0, reason.find(" ("));
+    std::lock_guard<std::mutex> lock(disconnectMutex_);
+    ++disconnectReasons_[std::string(key)];
+}
+
+std::vector<NetMetrics::TypeTotals> NetMetrics::typeTotals() const {
+    std::vector<TypeTotals> totals;
+    for (std::size_t i = 0; i < TrackedMessageTypes; ++i) {
+        const auto& counters = types_[i];
+        TypeTotals t;
+        t.type = static_cast<MessageType>(i);
+        t.messagesSent = counters.messagesSent.load(std::memory_order_relaxed);
+        t.bytesSent = counters.bytesSent.load(std::memory_order_relaxed);
+        t.messagesReceived = counters.messagesReceived.load(std::memory_order_relaxed);
+        t.bytesReceived = counters.bytesReceived.load(std::memory_order_relaxed);
+        if (t.messagesSent > 0 || t.messagesReceived > 0) {
+            totals.push_back(t);
+        }
+    }
+    std::sort(totals.begin(), totals.end(), [](const TypeTotals& a, const TypeTotals& b) {
+        return a.bytesSent + a.bytesReceived > b.bytesSent + b.bytesReceived;
+    });
+    return totals;
+}
+
+std::map<std::string, std::uint64_t> NetMetrics::disconnectReasons() const {
+    std::lock_guard<std::mutex> lock(disconnectMutex_);
+    return disconnectReasons_;
+}
+
+std::string NetMetrics::formatReport(std::string_view title) const {
+    std::string out;
+    char line[160];
+
+    out += "=== Network Stats: ";
+    out += title;
+    out += " ===\n";
+    out += "Connections: opened=" + std::to_string(connectionsOpened_.load(std::memory_order_relaxed)) +
+        " closed=" + std::to_string(connectionsClosed_.load(std::memory_order_relaxed)) + "\n";
+    out += "Writes: count=" + std::to_string(writes_.load(std::memory_order_relaxed)) +
+        " wireBytes=" + std::to_string(wireBytesWritten_.load(std::memory_order_relaxed)) +
+        " bundles=" + std::to_string(bundlesSent_.load(std::memory_order_relaxed)) +
+        " snapshotsSuperseded=" + std::to_string(snapshotsSuperseded_.load(std::memory_order_relaxed)) +
+        " queueDepthHighWater=" + std::to_string(queueDepthHighWater_.load(std::memory_order_relaxed)) + "\n";
+    out += "Write latency (queued -> written): " + writeLatency_.summary() + "\n";
+    if (rtt_.count() > 0) {
+        out += "Round trip (Ping/Pong): " + rtt_.summary() + "\n";
+    }
+
+    out += "Per message type:\n";
+    std::snprintf(line, sizeof(line), "  %-24s %12s %14s %12s %14s\n", "type", "sent", "sentBytes", "recv", "recvBytes");
+    out += line;
+    for (const auto& t : typeTotals()) {
+        std::snprintf(line, sizeof(line), "  %-24s %12llu %14llu %12llu %14llu\n",
+            static_cast<std::size_t>(t.type) == TrackedMessageTypes - 1 ? "(other)" : messageTypeName(t.type),
+            static_cast<unsigned long long>(t.messagesSent), static_cast<unsigned long long>(t.bytesSent),
+            static_cast<unsigned long long>(t.messagesReceived), static_cast<unsigned long long>(t.bytesReceived));
+        out += line;
+    }
+
+    auto reasons = disconnectReasons();
+    out += "Disconnect reasons:";
+    out += reasons.empty() ? " (none)\n" : "\n";
+    for (const auto& [reason, count] : reasons) {
+        out += "  " + std::to_string(count) + "x " + reason + "\n";
+    }
+    return out;
+}
+
+std::string NetMetrics::formatSummary() const {
+    std::uint64_t msgsSent = 0, bytesSent = 0, msgsRecv = 0, bytesRecv = 0;
+    auto totals = typeTotals();
+    for (const auto& t : totals) {
+        msgsSent += t.messagesSent;
+        bytesSent += t.bytesSent;
+        msgsRecv += t.messagesReceived;
+        bytesRecv += t.bytesReceived;
+    }
+
+    std::string out = "sent=" + std::to_string(msgsSent) + " msgs/" + std::to_string(bytesSent) + " B" +
+        ", recv=" + std::to_string(msgsRecv) + " msgs/" + std::to_string(bytesRecv) + " B" +
+        ", writes=" + std::to_string(writes_.load(std::memory_order_relaxed)) +
+        ", writeLatency[" + writeLatency_.summary() + "]" +
+        ", queueHighWater=" + std::to_string(queueDepthHighWater_.load(std::memory_order_relaxed)) +
+        (rtt_.count() > 0 ? ", rttP50<=" + std::to_string(rtt_.percentile(0.50).count() / 1000) + "ms" : std::string{}) +
+        ", disconnects=" + std::to_string(connectionsClosed_.load(std::memory_order_relaxed));
+    if (!totals.empty()) {
+        // Largest bandwidth consumer, the usual question
+        out += std::string{", top="} + messageTypeName(totals.front().type) + "(" +
+            std::to_string(totals.front().bytesSent + totals.front().bytesReceived) + " B)";
+    }
+    return out;
+}
+
+} // namespace req::shared::net
@@ -1,44 +1,18 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
-    }
-
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
-    }
+    using detail::split;
+    using detail::parseUInt;
 }
 
 // ============================================================================
@@ -54,7 +28,7 @@ std::string buildCharacterListRequestPayload(
 }
 
 bool parseCharacterListRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId) {
     auto tokens = split(payload, '|');
@@ -97,7 +71,7 @@ std::string buildCharacterListResponseErrorPayload(
 }
 
 bool parseCharacterListResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     CharacterListResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.empty()) {
@@ -146,7 +120,7 @@ bool parseCharacterListResponsePayload(
         outData.errorMessage = tokens[2];
         return true;
     } else {
-        req::shared::logError("Protocol", "CharacterListResponse: unknown status '" + tokens[0] + "'");
+        req::shared::logError("Protocol", "CharacterListResponse: unknown status '" + std::string(tokens[0]) + "'");
         return false;
     }
 }
@@ -167,7 +141,7 @@ std::string buildCharacterCreateRequestPayload(
 }
 
 bool parseCharacterCreateRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId,
     std::string& outName,
@@ -216,7 +190,7 @@ std::string buildCharacterCreateResponseErrorPayload(
 }
 
 bool parseCharacterCreateResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     CharacterCreateResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.empty()) {
@@ -252,7 +226,7 @@ bool parseCharacterCreateResponsePayload(
         outData.errorMessage = tokens[2];
         return true;
     } else {
-        req::shared::logError("Protocol", "CharacterCreateResponse: unknown status '" + tokens[0] + "'");
+        req::shared::logError("Protocol", "CharacterCreateResponse: unknown status '" + std::string(tokens[0]) + "'");
         return false;
     }
 }
@@ -271,7 +245,7 @@ std::string buildEnterWorldRequestPayload(
 }
 
 bool parseEnterWorldRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId,
     std::uint64_t& outCharacterId) {
@@ -318,7 +292,7 @@ std::string buildEnterWorldResponseErrorPayload(
 }
 
 bool parseEnterWorldResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     EnterWorldResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.empty()) {
@@ -356,7 +330,7 @@ bool parseEnterWorldResponsePayload(
         outData.errorMessage = tokens[2];
         return true;
     } else {
-        req::shared::logError("Protocol", "EnterWorldResponse: unknown status '" + tokens[0] + "'");
+        req::shared::logError("Protocol", "EnterWorldResponse: unknown status '" + std::string(tokens[0]) + "'");
         return false;
     }
 }
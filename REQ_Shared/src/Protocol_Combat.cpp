@@ -1,44 +1,20 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
+#include "../include/req/shared/ByteStream.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
-    }
-
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
-    }
+    using detail::split;
+    using detail::parseUInt;
+    using detail::toInt;
 }
 
 // ============================================================================
@@ -56,7 +32,7 @@ std::string buildAttackRequestPayload(
 }
 
 bool parseAttackRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     AttackRequestData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 4) {
@@ -98,7 +74,23 @@ bool parseAttackRequestPayload(
 // ============================================================================
 
 std::string buildAttackResultPayload(
-    const AttackResultData& data) {
+    const AttackResultData& data,
+    WireFormat format) {
+    if (format == WireFormat::Binary) {
+        std::string out;
+        out.reserve(32 + data.message.size());
+        out.push_back(static_cast<char>(BinaryPayloadMarker));
+        ByteWriter w(out);
+        w.writeU64(data.attackerId);
+        w.writeU64(data.targetId);
+        w.writeI32(data.damage);
+        w.writeBool(data.wasHit);
+        w.writeI32(data.remainingHp);
+        w.writeI32(data.resultCode);
+        w.writeString(data.message);
+        return out;
+    }
+    
     std::ostringstream oss;
     oss << data.attackerId << '|'
         << data.targetId << '|'
@@ -111,8 +103,26 @@ std::string buildAttackResultPayload(
 }
 
 bool parseAttackResultPayload(
-    const std::string& payload,
+    std::string_view payload,
     AttackResultData& outData) {
+    if (isBinaryPayload(payload)) {
+        ByteReader r(payload);
+        r.readU8();  // marker
+        outData.attackerId = r.readU64();
+        outData.targetId = r.readU64();
+        outData.damage = r.readI32();
+        outData.wasHit = r.readBool();
+        outData.remainingHp = r.readI32();
+        outData.resultCode = r.readI32();
+        outData.message = r.readString();
+        if (!r.ok()) {
+            req::shared::logError("Protocol", "AttackResult: truncated binary payload (" +
+                std::to_string(payload.size()) + " bytes)");
+            return false;
+        }
+        return true;
+    }
+    
     auto tokens = split(payload, '|');
     if (tokens.size() < 7) {
         req::shared::logError("Protocol", "AttackResult: expected 7 fields, got " + std::to_string(tokens.size()));
@@ -133,7 +143,7 @@ bool parseAttackResultPayload(
     
     // Parse damage
     try {
-        outData.damage = std::stoi(tokens[2]);
+        outData.damage = toInt(tokens[2]);
     } catch (...) {
         req::shared::logError("Protocol", "AttackResult: failed to parse damage");
         return false;
@@ -149,7 +159,7 @@ bool parseAttackResultPayload(
     
     // Parse remainingHp
     try {
-        outData.remainingHp = std::stoi(tokens[4]);
+        outData.remainingHp = toInt(tokens[4]);
     } catch (...) {
         req::shared::logError("Protocol", "AttackResult: failed to parse remainingHp");
         return false;
@@ -157,7 +167,7 @@ bool parseAttackResultPayload(
     
     // Parse resultCode
     try {
-        outData.resultCode = std::stoi(tokens[5]);
+        outData.resultCode = toInt(tokens[5]);
     } catch (...) {
         req::shared::logError("Protocol", "AttackResult: failed to parse resultCode");
         return false;
@@ -1,44 +1,17 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
-    }
-
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        if (s.empty()) return false;
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
-    }
+    using detail::split;
+    using detail::parseUInt;
 }
 
 // ============================================================================
@@ -56,7 +29,7 @@ std::string buildDevCommandPayload(
 }
 
 bool parseDevCommandPayload(
-    const std::string& payload,
+    std::string_view payload,
     DevCommandData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 4) {
@@ -95,7 +68,7 @@ std::string buildDevCommandResponsePayload(
 }
 
 bool parseDevCommandResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     DevCommandResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
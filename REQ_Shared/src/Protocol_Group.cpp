@@ -1,43 +1,18 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
-    }
-
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
-    }
+    using detail::split;
+    using detail::parseUInt;
+    using detail::toInt;
 }
 
 // ============================================================================
@@ -51,7 +26,7 @@ std::string buildGroupInviteRequestPayload(const GroupInviteRequestData& data) {
     return oss.str();
 }
 
-bool parseGroupInviteRequestPayload(const std::string& payload, GroupInviteRequestData& out) {
+bool parseGroupInviteRequestPayload(std::string_view payload, GroupInviteRequestData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
         logError("Protocol", "GroupInviteRequest: expected 2 fields");
@@ -81,7 +56,7 @@ std::string buildGroupInviteResponsePayload(const GroupInviteResponseData& data)
     return oss.str();
 }
 
-bool parseGroupInviteResponsePayload(const std::string& payload, GroupInviteResponseData& out) {
+bool parseGroupInviteResponsePayload(std::string_view payload, GroupInviteResponseData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 4) {
         logError("Protocol", "GroupInviteResponse: expected 4 fields");
@@ -116,7 +91,7 @@ std::string buildGroupAcceptRequestPayload(const GroupAcceptRequestData& data) {
     return oss.str();
 }
 
-bool parseGroupAcceptRequestPayload(const std::string& payload, GroupAcceptRequestData& out) {
+bool parseGroupAcceptRequestPayload(std::string_view payload, GroupAcceptRequestData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
         logError("Protocol", "GroupAcceptRequest: expected 2 fields");
@@ -147,7 +122,7 @@ std::string buildGroupDeclineRequestPayload(const GroupDeclineRequestData& data)
     return oss.str();
 }
 
-bool parseGroupDeclineRequestPayload(const std::string& payload, GroupDeclineRequestData& out) {
+bool parseGroupDeclineRequestPayload(std::string_view payload, GroupDeclineRequestData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
         logError("Protocol", "GroupDeclineRequest: expected 2 fields");
@@ -176,7 +151,7 @@ std::string buildGroupLeaveRequestPayload(const GroupLeaveRequestData& data) {
     return std::to_string(data.characterId);
 }
 
-bool parseGroupLeaveRequestPayload(const std::string& payload, GroupLeaveRequestData& out) {
+bool parseGroupLeaveRequestPayload(std::string_view payload, GroupLeaveRequestData& out) {
     if (!parseUInt(payload, out.characterId)) {
         logError("Protocol", "GroupLeaveRequest: failed to parse characterId");
         return false;
@@ -195,7 +170,7 @@ std::string buildGroupKickRequestPayload(const GroupKickRequestData& data) {
     return oss.str();
 }
 
-bool parseGroupKickRequestPayload(const std::string& payload, GroupKickRequestData& out) {
+bool parseGroupKickRequestPayload(std::string_view payload, GroupKickRequestData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
         logError("Protocol", "GroupKickRequest: expected 2 fields");
@@ -224,7 +199,7 @@ std::string buildGroupDisbandRequestPayload(const GroupDisbandRequestData& data)
     return std::to_string(data.leaderCharacterId);
 }
 
-bool parseGroupDisbandRequestPayload(const std::string& payload, GroupDisbandRequestData& out) {
+bool parseGroupDisbandRequestPayload(std::string_view payload, GroupDisbandRequestData& out) {
     if (!parseUInt(payload, out.leaderCharacterId)) {
         logError("Protocol", "GroupDisbandRequest: failed to parse leaderCharacterId");
         return false;
@@ -259,7 +234,7 @@ std::string buildGroupUpdateNotifyPayload(const GroupUpdateNotifyData& data) {
     return oss.str();
 }
 
-bool parseGroupUpdateNotifyPayload(const std::string& payload, GroupUpdateNotifyData& out) {
+bool parseGroupUpdateNotifyPayload(std::string_view payload, GroupUpdateNotifyData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 4) {
         logError("Protocol", "GroupUpdateNotify: expected at least 4 fields");
@@ -312,10 +287,10 @@ bool parseGroupUpdateNotifyPayload(const std::string& payload, GroupUpdateNotify
         member.characterClass = tokens[idx++];
         
         try {
-            member.hp = std::stoi(tokens[idx++]);
-            member.maxHp = std::stoi(tokens[idx++]);
-            member.mana = std::stoi(tokens[idx++]);
-            member.maxMana = std::stoi(tokens[idx++]);
+            member.hp = toInt(tokens[idx++]);
+            member.maxHp = toInt(tokens[idx++]);
+            member.mana = toInt(tokens[idx++]);
+            member.maxMana = toInt(tokens[idx++]);
         } catch (...) {
             logError("Protocol", "GroupUpdateNotify: failed to parse member stats");
             return false;
@@ -348,7 +323,7 @@ std::string buildGroupChatMessagePayload(const GroupChatMessageData& data) {
     return oss.str();
 }
 
-bool parseGroupChatMessagePayload(const std::string& payload, GroupChatMessageData& out) {
+bool parseGroupChatMessagePayload(std::string_view payload, GroupChatMessageData& out) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 4) {
         logError("Protocol", "GroupChatMessage: expected 4 fields");
@@ -1,44 +1,18 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
-    }
-
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
-    }
+    using detail::split;
+    using detail::parseUInt;
 }
 
 // ============================================================================
@@ -57,7 +31,7 @@ std::string buildLoginRequestPayload(
 }
 
 bool parseLoginRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     std::string& outUsername,
     std::string& outPassword,
     std::string& outClientVersion,
@@ -78,7 +52,7 @@ bool parseLoginRequestPayload(
         } else if (tokens[3] == "login") {
             outMode = LoginMode::Login;
         } else {
-            req::shared::logWarn("Protocol", "LoginRequest: unknown mode '" + tokens[3] + "', defaulting to login");
+            req::shared::logWarn("Protocol", "LoginRequest: unknown mode '" + std::string(tokens[3]) + "', defaulting to login");
             outMode = LoginMode::Login;
         }
     } else {
@@ -114,7 +88,7 @@ std::string buildLoginResponseErrorPayload(
 }
 
 bool parseLoginResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     LoginResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.empty()) {
@@ -184,7 +158,7 @@ bool parseLoginResponsePayload(
         outData.errorMessage = tokens[2];
         return true;
     } else {
-        req::shared::logError("Protocol", "LoginResponse: unknown status '" + tokens[0] + "'");
+        req::shared::logError("Protocol", "LoginResponse: unknown status '" + std::string(tokens[0]) + "'");
         return false;
     }
 }
@@ -1,44 +1,18 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
-    }
-
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
-    }
+    using detail::split;
+    using detail::parseUInt;
 }
 
 // ============================================================================
@@ -54,7 +28,7 @@ std::string buildWorldAuthRequestPayload(
 }
 
 bool parseWorldAuthRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     SessionToken& outSessionToken,
     WorldId& outWorldId) {
     auto tokens = split(payload, '|');
@@ -96,7 +70,7 @@ std::string buildWorldAuthResponseErrorPayload(
 }
 
 bool parseWorldAuthResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     WorldAuthResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.empty()) {
@@ -134,7 +108,7 @@ bool parseWorldAuthResponsePayload(
         outData.errorMessage = tokens[2];
         return true;
     } else {
-        req::shared::logError("Protocol", "WorldAuthResponse: unknown status '" + tokens[0] + "'");
+        req::shared::logError("Protocol", "WorldAuthResponse: unknown status '" + std::string(tokens[0]) + "'");
         return false;
     }
 }
@@ -1,43 +1,46 @@
 #include "../include/req/shared/ProtocolSchemas.h"
 #include "../include/req/shared/Logger.h"
+#include "../include/req/shared/ProtocolParse.h"
+#include "../include/req/shared/ByteStream.h"
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <algorithm>
+#include <cstring>
 
 namespace req::shared::protocol {
 
 namespace {
-    // Helper: split string by delimiter
-    std::vector<std::string> split(const std::string& s, char delim) {
-        std::vector<std::string> tokens;
-        std::size_t start = 0;
-        while (true) {
-            auto pos = s.find(delim, start);
-            if (pos == std::string::npos) {
-                tokens.emplace_back(s.substr(start));
-                break;
-            }
-            tokens.emplace_back(s.substr(start, pos - start));
-            start = pos + 1;
-        }
-        return tokens;
+    using detail::split;
+    using detail::parseUInt;
+    using detail::toInt;
+    using detail::toUInt64;
+    using detail::toFloat;
+
+    // Helper: start a binary payload with the format marker
+    std::string beginBinaryPayload(std::size_t reserveBytes) {
+        std::string out;
+        out.reserve(reserveBytes);
+        out.push_back(static_cast<char>(BinaryPayloadMarker));
+        return out;
     }
 
-    // Helper: parse unsigned integer safely
-    template<typename T>
-    bool parseUInt(const std::string& s, T& out) {
-        try {
-            if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-                out = static_cast<T>(std::stoul(s));
-            } else {
-                out = static_cast<T>(std::stoull(s));
-            }
-            return true;
-        } catch (...) {
+    std::string beginQuantizedPayload(std::size_t reserveBytes) {
+        std::string out;
+        out.reserve(reserveBytes);
+        out.push_back(static_cast<char>(QuantizedPayloadMarker));
+        return out;
+    }
+
+    // Quantized payloads need the session's params to decode
+    bool requireQuantization(const QuantizationParams* quantization, const char* message) {
+        if (!quantization) {
+            req::shared::logError("Protocol", std::string{message} + ": quantized payload but no QuantizationParams negotiated");
             return false;
         }
+        return true;
     }
 }
 
@@ -47,16 +50,29 @@ namespace {
 
 std::string buildZoneAuthRequestPayload(
     HandoffToken handoffToken,
-    PlayerId characterId) {
+    PlayerId characterId,
+    std::uint32_t capabilities) {
     std::ostringstream oss;
     oss << handoffToken << '|' << characterId;
+    if (capabilities != ZoneCapability::None) {
+        oss << '|' << capabilities;
+    }
     return oss.str();
 }
 
 bool parseZoneAuthRequestPayload(
-    const std::string& payload,
+    std::string_view payload,
     HandoffToken& outHandoffToken,
     PlayerId& outCharacterId) {
+    std::uint32_t ignoredCapabilities = 0;
+    return parseZoneAuthRequestPayload(payload, outHandoffToken, outCharacterId, ignoredCapabilities);
+}
+
+bool parseZoneAuthRequestPayload(
+    std::string_view payload,
+    HandoffToken& outHandoffToken,
+    PlayerId& outCharacterId,
+    std::uint32_t& outCapabilities) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
         req::shared::logError("Protocol", "ZoneAuthRequest: expected 2 fields, got " + std::to_string(tokens.size()));
@@ -70,6 +86,13 @@ bool parseZoneAuthRequestPayload(
         req::shared::logError("Protocol", "ZoneAuthRequest: failed to parse characterId");
         return false;
     }
+    
+    // Optional capabilities field (older clients omit it)
+    outCapabilities = ZoneCapability::None;
+    if (tokens.size() >= 3 && !parseUInt(tokens[2], outCapabilities)) {
+        req::shared::logWarn("Protocol", "ZoneAuthRequest: invalid capabilities '" + std::string(tokens[2]) + "', defaulting to 0");
+        outCapabilities = ZoneCapability::None;
+    }
     return true;
 }
 
@@ -78,9 +101,24 @@ bool parseZoneAuthRequestPayload(
 // ============================================================================
 
 std::string buildZoneAuthResponseOkPayload(
-    const std::string& welcomeMessage) {
+    const std::string& welcomeMessage,
+    std::uint32_t capabilities,
+    std::uint16_t udpPort,
+    const QuantizationParams* quantization) {
     std::ostringstream oss;
     oss << "OK|" << welcomeMessage;
+    if (capabilities != ZoneCapability::None) {
+        oss << '|' << capabilities;
+        bool sendQuantization = (capabilities & ZoneCapability::QuantizedState) && quantization;
+        if ((capabilities & ZoneCapability::UdpChannel) && udpPort != 0) {
+            oss << '|' << udpPort;
+        } else if (sendQuantization) {
+            oss << "|0";
+        }
+        if (sendQuantization) {
+            oss << '|' << buildQuantizationParamsField(*quantization);
+        }
+    }
     return oss.str();
 }
 
@@ -93,7 +131,7 @@ std::string buildZoneAuthResponseErrorPayload(
 }
 
 bool parseZoneAuthResponsePayload(
-    const std::string& payload,
+    std::string_view payload,
     ZoneAuthResponseData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.empty()) {
@@ -108,6 +146,27 @@ bool parseZoneAuthResponsePayload(
         }
         outData.success = true;
         outData.welcomeMessage = tokens[1];
+        outData.capabilities = ZoneCapability::None;
+        if (tokens.size() >= 3 && !parseUInt(tokens[2], outData.capabilities)) {
+            req::shared::logWarn("Protocol", "ZoneAuthResponse OK: invalid capabilities '" + std::string(tokens[2]) + "', defaulting to 0");
+            outData.capabilities = ZoneCapability::None;
+        }
+        outData.udpPort = 0;
+        if (tokens.size() >= 4 && !parseUInt(tokens[3], outData.udpPort)) {
+            req::shared::logWarn("Protocol", "ZoneAuthResponse OK: invalid udpPort '" + std::string(tokens[3]) + "', UDP disabled");
+            outData.udpPort = 0;
+        }
+        if (outData.udpPort == 0) {
+            outData.capabilities &= ~ZoneCapability::UdpChannel;
+        }
+        outData.quantization = QuantizationParams{};
+        if (outData.capabilities & ZoneCapability::QuantizedState) {
+            if (tokens.size() < 5 || !parseQuantizationParamsField(tokens[4], outData.quantization)) {
+                req::shared::logWarn("Protocol", "ZoneAuthResponse OK: QuantizedState without valid params, quantization disabled");
+                outData.capabilities &= ~ZoneCapability::QuantizedState;
+                outData.quantization = QuantizationParams{};
+            }
+        }
         return true;
     } else if (tokens[0] == "ERR") {
         if (tokens.size() < 3) {
@@ -119,7 +178,7 @@ bool parseZoneAuthResponsePayload(
         outData.errorMessage = tokens[2];
         return true;
     } else {
-        req::shared::logError("Protocol", "ZoneAuthResponse: unknown status '" + tokens[0] + "'");
+        req::shared::logError("Protocol", "ZoneAuthResponse: unknown status '" + std::string(tokens[0]) + "'");
         return false;
     }
 }
@@ -129,7 +188,22 @@ bool parseZoneAuthResponsePayload(
 // ============================================================================
 
 std::string buildMovementIntentPayload(
-    const MovementIntentData& data) {
+    const MovementIntentData& data,
+    WireFormat format) {
+    if (format == WireFormat::Binary) {
+        std::string out = beginBinaryPayload(42);
+        ByteWriter w(out);
+        w.writeU64(data.characterId);
+        w.writeU32(data.sequenceNumber);
+        w.writeF32(data.inputX);
+        w.writeF32(data.inputY);
+        w.writeF32(data.facingYawDegrees);
+        w.writeBool(data.isJumpPressed);
+        w.writeU64(data.clientTimeMs);
+        w.writeU64(data.ackSnapshotId);
+        return out;
+    }
+    
     std::ostringstream oss;
     oss << data.characterId << '|'
         << data.sequenceNumber << '|'
@@ -137,70 +211,91 @@ std::string buildMovementIntentPayload(
         << data.inputY << '|'
         << data.facingYawDegrees << '|'
         << (data.isJumpPressed ? 1 : 0) << '|'
-        << data.clientTimeMs;
+        << data.clientTimeMs << '|'
+        << data.ackSnapshotId;
     return oss.str();
 }
 
 bool parseMovementIntentPayload(
-    const std::string& payload,
+    std::string_view payload,
     MovementIntentData& outData) {
+    if (isBinaryPayload(payload)) {
+        ByteReader r(payload);
+        r.readU8();  // marker
+        outData.characterId = r.readU64();
+        outData.sequenceNumber = r.readU32();
+        outData.inputX = r.readF32();
+        outData.inputY = r.readF32();
+        outData.facingYawDegrees = r.readF32();
+        outData.isJumpPressed = r.readBool();
+        outData.clientTimeMs = r.readU64();
+        if (!r.ok()) {
+            req::shared::logError("Protocol", "MovementIntent: truncated binary payload (" +
+                std::to_string(payload.size()) + " bytes)");
+            return false;
+        }
+        // Trailing ack is optional (older clients end at clientTimeMs)
+        outData.ackSnapshotId = r.remaining() >= 8 ? r.readU64() : 0;
+        return true;
+    }
+    
     auto tokens = split(payload, '|');
     if (tokens.size() < 7) {
         req::shared::logError("Protocol", std::string{"MovementIntent: expected 7 fields, got "} + 
-            std::to_string(tokens.size()) + ", payload='" + payload + "'");
+            std::to_string(tokens.size()) + ", payload='" + std::string(payload) + "'");
         return false;
     }
     
     // Parse characterId
     if (!parseUInt(tokens[0], outData.characterId)) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse characterId from '"} + 
-            tokens[0] + "', payload='" + payload + "'");
+            std::string(tokens[0]) + "', payload='" + std::string(payload) + "'");
         return false;
     }
     
     // Parse sequenceNumber
     if (!parseUInt(tokens[1], outData.sequenceNumber)) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse sequenceNumber from '"} + 
-            tokens[1] + "', payload='" + payload + "'");
+            std::string(tokens[1]) + "', payload='" + std::string(payload) + "'");
         return false;
     }
     
     // Parse inputX
     try {
-        outData.inputX = std::stof(tokens[2]);
+        outData.inputX = toFloat(tokens[2]);
     } catch (const std::exception& e) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse inputX from '"} + 
-            tokens[2] + "': " + e.what() + ", payload='" + payload + "'");
+            std::string(tokens[2]) + "': " + e.what() + ", payload='" + std::string(payload) + "'");
         return false;
     } catch (...) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse inputX from '"} + 
-            tokens[2] + "' (unknown exception), payload='" + payload + "'");
+            std::string(tokens[2]) + "' (unknown exception), payload='" + std::string(payload) + "'");
         return false;
     }
     
     // Parse inputY
     try {
-        outData.inputY = std::stof(tokens[3]);
+        outData.inputY = toFloat(tokens[3]);
     } catch (const std::exception& e) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse inputY from '"} + 
-            tokens[3] + "': " + e.what() + ", payload='" + payload + "'");
+            std::string(tokens[3]) + "': " + e.what() + ", payload='" + std::string(payload) + "'");
         return false;
     } catch (...) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse inputY from '"} + 
-            tokens[3] + "' (unknown exception), payload='" + payload + "'");
+            std::string(tokens[3]) + "' (unknown exception), payload='" + std::string(payload) + "'");
         return false;
     }
     
     // Parse facingYawDegrees
     try {
-        outData.facingYawDegrees = std::stof(tokens[4]);
+        outData.facingYawDegrees = toFloat(tokens[4]);
     } catch (const std::exception& e) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse facingYawDegrees from '"} + 
-            tokens[4] + "': " + e.what() + ", payload='" + payload + "'");
+            std::string(tokens[4]) + "': " + e.what() + ", payload='" + std::string(payload) + "'");
         return false;
     } catch (...) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse facingYawDegrees from '"} + 
-            tokens[4] + "' (unknown exception), payload='" + payload + "'");
+            std::string(tokens[4]) + "' (unknown exception), payload='" + std::string(payload) + "'");
         return false;
     }
     
@@ -208,24 +303,32 @@ bool parseMovementIntentPayload(
     std::uint32_t jumpValue = 0;
     if (!parseUInt(tokens[5], jumpValue)) {
         req::shared::logError("Protocol", std::string{"MovementIntent: failed to parse isJumpPressed from '"} + 
-            tokens[5] + "', payload='" + payload + "'");
+            std::string(tokens[5]) + "', payload='" + std::string(payload) + "'");
         return false;
     }
     outData.isJumpPressed = (jumpValue != 0);
     
     // Parse clientTimeMs (tolerant - default to 0 on failure, don't fail entire parse)
     try {
-        outData.clientTimeMs = std::stoull(tokens[6]);
+        outData.clientTimeMs = toUInt64(tokens[6]);
     } catch (const std::exception& e) {
         req::shared::logWarn("Protocol", std::string{"MovementIntent: invalid clientTimeMs '"} + 
-            tokens[6] + "' (" + e.what() + "), defaulting to 0");
+            std::string(tokens[6]) + "' (" + e.what() + "), defaulting to 0");
         outData.clientTimeMs = 0;
     } catch (...) {
         req::shared::logWarn("Protocol", std::string{"MovementIntent: invalid clientTimeMs '"} + 
-            tokens[6] + "' (unknown exception), defaulting to 0");
+            std::string(tokens[6]) + "' (unknown exception), defaulting to 0");
         outData.clientTimeMs = 0;
     }
     
+    // Parse ackSnapshotId (optional; tolerant like clientTimeMs)
+    outData.ackSnapshotId = 0;
+    if (tokens.size() >= 8 && !parseUInt(tokens[7], outData.ackSnapshotId)) {
+        req::shared::logWarn("Protocol", std::string{"MovementIntent: invalid ackSnapshotId '"} +
+            std::string(tokens[7]) + "', defaulting to 0");
+        outData.ackSnapshotId = 0;
+    }
+    
     return true;
 }
 
@@ -234,7 +337,48 @@ bool parseMovementIntentPayload(
 // ============================================================================
 
 std::string buildPlayerStateSnapshotPayload(
-    const PlayerStateSnapshotData& data) {
+    const PlayerStateSnapshotData& data,
+    WireFormat format,
+    const QuantizationParams* quantization) {
+    if (format == WireFormat::Binary && quantization) {
+        std::size_t count = std::min<std::size_t>(data.players.size(), 0xFFFF);
+        std::string out = beginQuantizedPayload(11 + count * 36);
+        ByteWriter w(out);
+        w.writeU64(data.snapshotId);
+        w.writeU16(static_cast<std::uint16_t>(count));
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& player = data.players[i];
+            w.writeU64(player.characterId);
+            writeQuantizedField(w, QuantizedField::PosX, player.posX, *quantization);
+            writeQuantizedField(w, QuantizedField::PosY, player.posY, *quantization);
+            writeQuantizedField(w, QuantizedField::PosZ, player.posZ, *quantization);
+            writeQuantizedField(w, QuantizedField::VelX, player.velX, *quantization);
+            writeQuantizedField(w, QuantizedField::VelY, player.velY, *quantization);
+            writeQuantizedField(w, QuantizedField::VelZ, player.velZ, *quantization);
+            writeQuantizedField(w, QuantizedField::Yaw, player.yawDegrees, *quantization);
+        }
+        return out;
+    }
+    if (format == WireFormat::Binary) {
+        std::size_t count = std::min<std::size_t>(data.players.size(), 0xFFFF);
+        std::string out = beginBinaryPayload(11 + count * 36);
+        ByteWriter w(out);
+        w.writeU64(data.snapshotId);
+        w.writeU16(static_cast<std::uint16_t>(count));
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& player = data.players[i];
+            w.writeU64(player.characterId);
+            w.writeF32(player.posX);
+            w.writeF32(player.posY);
+            w.writeF32(player.posZ);
+            w.writeF32(player.velX);
+            w.writeF32(player.velY);
+            w.writeF32(player.velZ);
+            w.writeF32(player.yawDegrees);
+        }
+        return out;
+    }
+    
     std::ostringstream oss;
     oss << data.snapshotId << '|' << data.players.size();
     
@@ -253,8 +397,72 @@ std::string buildPlayerStateSnapshotPayload(
 }
 
 bool parsePlayerStateSnapshotPayload(
-    const std::string& payload,
-    PlayerStateSnapshotData& outData) {
+    std::string_view payload,
+    PlayerStateSnapshotData& outData,
+    const QuantizationParams* quantization) {
+    if (isQuantizedPayload(payload)) {
+        if (!requireQuantization(quantization, "PlayerStateSnapshot")) {
+            return false;
+        }
+        std::size_t entryBytes = 8;
+        for (std::uint8_t f = 0; f < QuantizedFieldCount; ++f) {
+            entryBytes += quantizedFieldBytes(static_cast<QuantizedField>(f), *quantization);
+        }
+        
+        ByteReader r(payload);
+        r.readU8();  // marker
+        outData.snapshotId = r.readU64();
+        std::uint16_t playerCount = r.readU16();
+        if (!r.ok() || r.remaining() < static_cast<std::size_t>(playerCount) * entryBytes) {
+            req::shared::logError("Protocol", "PlayerStateSnapshot: truncated quantized payload (" +
+                std::to_string(payload.size()) + " bytes)");
+            return false;
+        }
+        
+        outData.players.clear();
+        outData.players.reserve(playerCount);
+        for (std::uint16_t i = 0; i < playerCount; ++i) {
+            PlayerStateEntry entry;
+            entry.characterId = r.readU64();
+            entry.posX = readQuantizedField(r, QuantizedField::PosX, *quantization);
+            entry.posY = readQuantizedField(r, QuantizedField::PosY, *quantization);
+            entry.posZ = readQuantizedField(r, QuantizedField::PosZ, *quantization);
+            entry.velX = readQuantizedField(r, QuantizedField::VelX, *quantization);
+            entry.velY = readQuantizedField(r, QuantizedField::VelY, *quantization);
+            entry.velZ = readQuantizedField(r, QuantizedField::VelZ, *quantization);
+            entry.yawDegrees = readQuantizedField(r, QuantizedField::Yaw, *quantization);
+            outData.players.push_back(entry);
+        }
+        return r.ok();
+    }
+    if (isBinaryPayload(payload)) {
+        ByteReader r(payload);
+        r.readU8();  // marker
+        outData.snapshotId = r.readU64();
+        std::uint16_t playerCount = r.readU16();
+        if (!r.ok() || r.remaining() < static_cast<std::size_t>(playerCount) * 36) {
+            req::shared::logError("Protocol", "PlayerStateSnapshot: truncated binary payload (" +
+                std::to_string(payload.size()) + " bytes)");
+            return false;
+        }
+        
+        outData.players.clear();
+        outData.players.reserve(playerCount);
+        for (std::uint16_t i = 0; i < playerCount; ++i) {
+            PlayerStateEntry entry;
+            entry.characterId = r.readU64();
+            entry.posX = r.readF32();
+            entry.posY = r.readF32();
+            entry.posZ = r.readF32();
+            entry.velX = r.readF32();
+            entry.velY = r.readF32();
+            entry.velZ = r.readF32();
+            entry.yawDegrees = r.readF32();
+            outData.players.push_back(entry);
+        }
+        return r.ok();
+    }
+    
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
         req::shared::logError("Protocol", "PlayerStateSnapshot: expected at least 2 fields, got " + std::to_string(tokens.size()));
@@ -303,9 +511,9 @@ bool parsePlayerStateSnapshotPayload(
         
         // Parse position (posX, posY, posZ)
         try {
-            entry.posX = std::stof(playerTokens[1]);
-            entry.posY = std::stof(playerTokens[2]);
-            entry.posZ = std::stof(playerTokens[3]);
+            entry.posX = toFloat(playerTokens[1]);
+            entry.posY = toFloat(playerTokens[2]);
+            entry.posZ = toFloat(playerTokens[3]);
         } catch (...) {
             req::shared::logError("Protocol", "PlayerStateSnapshot: failed to parse player position");
             return false;
@@ -313,9 +521,9 @@ bool parsePlayerStateSnapshotPayload(
         
         // Parse velocity (velX, velY, velZ)
         try {
-            entry.velX = std::stof(playerTokens[4]);
-            entry.velY = std::stof(playerTokens[5]);
-            entry.velZ = std::stof(playerTokens[6]);
+            entry.velX = toFloat(playerTokens[4]);
+            entry.velY = toFloat(playerTokens[5]);
+            entry.velZ = toFloat(playerTokens[6]);
         } catch (...) {
             req::shared::logError("Protocol", "PlayerStateSnapshot: failed to parse player velocity");
             return false;
@@ -323,7 +531,7 @@ bool parsePlayerStateSnapshotPayload(
         
         // Parse yawDegrees
         try {
-            entry.yawDegrees = std::stof(playerTokens[7]);
+            entry.yawDegrees = toFloat(playerTokens[7]);
         } catch (...) {
             req::shared::logError("Protocol", "PlayerStateSnapshot: failed to parse player yawDegrees");
             return false;
@@ -335,6 +543,210 @@ bool parsePlayerStateSnapshotPayload(
     return true;
 }
 
+// ============================================================================
+// PlayerStateDelta (ZoneServer ? client, DeltaSnapshots)
+// ============================================================================
+
+namespace {
+    // Field accessors in PlayerStateField bit order
+    constexpr float PlayerStateEntry::* DeltaFields[] = {
+        &PlayerStateEntry::posX, &PlayerStateEntry::posY, &PlayerStateEntry::posZ,
+        &PlayerStateEntry::velX, &PlayerStateEntry::velY, &PlayerStateEntry::velZ,
+        &PlayerStateEntry::yawDegrees
+    };
+    constexpr std::size_t DeltaFieldCount = sizeof(DeltaFields) / sizeof(DeltaFields[0]);
+    static_assert(DeltaFieldCount == QuantizedFieldCount, "QuantizedField must follow PlayerStateField order");
+
+    bool sameBits(float a, float b) {
+        return std::memcmp(&a, &b, sizeof(float)) == 0;
+    }
+
+    std::uint8_t changedFields(const PlayerStateEntry& before, const PlayerStateEntry& after) {
+        std::uint8_t mask = 0;
+        for (std::size_t i = 0; i < DeltaFieldCount; ++i) {
+            if (!sameBits(before.*DeltaFields[i], after.*DeltaFields[i])) {
+                mask |= static_cast<std::uint8_t>(1u << i);
+            }
+        }
+        return mask;
+    }
+}
+
+std::string buildPlayerStateDeltaPayload(
+    const PlayerStateDeltaData& data,
+    const QuantizationParams* quantization) {
+    std::size_t changedCount = std::min<std::size_t>(data.changed.size(), 0xFFFF);
+    std::size_t removedCount = std::min<std::size_t>(data.removed.size(), 0xFFFF);
+    std::size_t reserveBytes = 21 + changedCount * 37 + removedCount * 8;
+    std::string out = quantization ? beginQuantizedPayload(reserveBytes) : beginBinaryPayload(reserveBytes);
+    ByteWriter w(out);
+    w.writeU64(data.snapshotId);
+    w.writeU64(data.baselineSnapshotId);
+    w.writeU16(static_cast<std::uint16_t>(changedCount));
+    w.writeU16(static_cast<std::uint16_t>(removedCount));
+    for (std::size_t i = 0; i < changedCount; ++i) {
+        const auto& entry = data.changed[i];
+        std::uint8_t mask = entry.fieldMask & PlayerStateField::All;
+        w.writeU64(entry.state.characterId);
+        w.writeU8(mask);
+        for (std::size_t f = 0; f < DeltaFieldCount; ++f) {
+            if (!(mask & (1u << f))) {
+                continue;
+            }
+            if (quantization) {
+                writeQuantizedField(w, static_cast<QuantizedField>(f), entry.state.*DeltaFields[f], *quantization);
+            } else {
+                w.writeF32(entry.state.*DeltaFields[f]);
+            }
+        }
+    }
+    for (std::size_t i = 0; i < removedCount; ++i) {
+        w.writeU64(data.removed[i]);
+    }
+    return out;
+}
+
+bool parsePlayerStateDeltaPayload(
+    std::string_view payload,
+    PlayerStateDeltaData& outData,
+    const QuantizationParams* quantization) {
+    bool quantized = isQuantizedPayload(payload);
+    if (quantized && !requireQuantization(quantization, "PlayerStateDelta")) {
+        return false;
+    }
+    if (!quantized && !isBinaryPayload(payload)) {
+        req::shared::logError("Protocol", "PlayerStateDelta: payload is not binary");
+        return false;
+    }
+    
+    ByteReader r(payload);
+    r.readU8();  // marker
+    outData.snapshotId = r.readU64();
+    outData.baselineSnapshotId = r.readU64();
+    std::uint16_t changedCount = r.readU16();
+    std::uint16_t removedCount = r.readU16();
+    // Smallest possible entry is id + mask
+    if (!r.ok() || r.remaining() < static_cast<std::size_t>(changedCount) * 9 + static_cast<std::size_t>(removedCount) * 8) {
+        req::shared::logError("Protocol", "PlayerStateDelta: truncated binary payload (" +
+            std::to_string(payload.size()) + " bytes)");
+        return false;
+    }
+    
+    outData.changed.clear();
+    outData.changed.reserve(changedCount);
+    for (std::uint16_t i = 0; i < changedCount; ++i) {
+        PlayerStateDeltaEntry entry;
+        entry.state.characterId = r.readU64();
+        entry.fieldMask = r.readU8();
+        if (entry.fieldMask & ~PlayerStateField::All) {
+            req::shared::logError("Protocol", "PlayerStateDelta: invalid field mask " + std::to_string(entry.fieldMask));
+            return false;
+        }
+        for (std::size_t f = 0; f < DeltaFieldCount; ++f) {
+            if (!(entry.fieldMask & (1u << f))) {
+                continue;
+            }
+            entry.state.*DeltaFields[f] = quantized
+                ? readQuantizedField(r, static_cast<QuantizedField>(f), *quantization)
+                : r.readF32();
+        }
+        outData.changed.push_back(entry);
+    }
+    
+    outData.removed.clear();
+    outData.removed.reserve(removedCount);
+    for (std::uint16_t i = 0; i < removedCount; ++i) {
+        outData.removed.push_back(r.readU64());
+    }
+    
+    if (!r.ok()) {
+        req::shared::logError("Protocol", "PlayerStateDelta: truncated binary payload (" +
+            std::to_string(payload.size()) + " bytes)");
+        return false;
+    }
+    return true;
+}
+
+void diffPlayerStates(
+    const std::vector<PlayerStateEntry>& baseline,
+    const std::vector<PlayerStateEntry>& current,
+    PlayerStateDeltaData& outDelta) {
+    outDelta.changed.clear();
+    outDelta.removed.clear();
+    
+    // Merge walk over both sorted lists
+    std::size_t b = 0;
+    std::size_t c = 0;
+    while (b < baseline.size() || c < current.size()) {
+        if (c == current.size() || (b < baseline.size() && baseline[b].characterId < current[c].characterId)) {
+            outDelta.removed.push_back(baseline[b].characterId);
+            ++b;
+        } else if (b == baseline.size() || current[c].characterId < baseline[b].characterId) {
+            outDelta.changed.push_back(PlayerStateDeltaEntry{ current[c], PlayerStateField::All });
+            ++c;
+        } else {
+            std::uint8_t mask = changedFields(baseline[b], current[c]);
+            if (mask != 0) {
+                outDelta.changed.push_back(PlayerStateDeltaEntry{ current[c], mask });
+            }
+            ++b;
+            ++c;
+        }
+    }
+}
+
+void snapPlayerStateToQuantized(PlayerStateEntry& entry, const QuantizationParams& params) {
+    for (std::size_t f = 0; f < DeltaFieldCount; ++f) {
+        entry.*DeltaFields[f] = snapToQuantized(static_cast<QuantizedField>(f), entry.*DeltaFields[f], params);
+    }
+}
+
+bool applyPlayerStateDelta(
+    const std::vector<PlayerStateEntry>& baseline,
+    const PlayerStateDeltaData& delta,
+    std::vector<PlayerStateEntry>& outState) {
+    outState.clear();
+    outState.reserve(baseline.size() + delta.changed.size());
+    
+    auto byId = [](const PlayerStateEntry& a, const PlayerStateEntry& b) {
+        return a.characterId < b.characterId;
+    };
+    
+    // Baseline minus removed entries, then overlay the changes
+    std::vector<std::uint64_t> removed = delta.removed;
+    std::sort(removed.begin(), removed.end());
+    for (const auto& entry : baseline) {
+        if (!std::binary_search(removed.begin(), removed.end(), entry.characterId)) {
+            outState.push_back(entry);
+        }
+    }
+    
+    std::vector<PlayerStateEntry> added;
+    for (const auto& change : delta.changed) {
+        auto it = std::lower_bound(outState.begin(), outState.end(), change.state, byId);
+        if (it != outState.end() && it->characterId == change.state.characterId) {
+            for (std::size_t f = 0; f < DeltaFieldCount; ++f) {
+                if (change.fieldMask & (1u << f)) {
+                    (*it).*DeltaFields[f] = change.state.*DeltaFields[f];
+                }
+            }
+        } else if (change.fieldMask == PlayerStateField::All) {
+            added.push_back(change.state);
+        } else {
+            req::shared::logError("Protocol", "PlayerStateDelta: partial entry for characterId=" +
+                std::to_string(change.state.characterId) + " not in baseline " +
+                std::to_string(delta.baselineSnapshotId));
+            return false;
+        }
+    }
+    
+    if (!added.empty()) {
+        outState.insert(outState.end(), added.begin(), added.end());
+        std::sort(outState.begin(), outState.end(), byId);
+    }
+    return true;
+}
+
 // ============================================================================
 // EntitySpawn
 // ============================================================================
@@ -358,7 +770,7 @@ std::string buildEntitySpawnPayload(
 }
 
 bool parseEntitySpawnPayload(
-    const std::string& payload,
+    std::string_view payload,
     EntitySpawnData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 12) {
@@ -390,9 +802,9 @@ bool parseEntitySpawnPayload(
     
     // Parse position (posX, posY, posZ)
     try {
-        outData.posX = std::stof(tokens[4]);
-        outData.posY = std::stof(tokens[5]);
-        outData.posZ = std::stof(tokens[6]);
+        outData.posX = toFloat(tokens[4]);
+        outData.posY = toFloat(tokens[5]);
+        outData.posZ = toFloat(tokens[6]);
     } catch (...) {
         req::shared::logError("Protocol", "EntitySpawn: failed to parse position");
         return false;
@@ -400,7 +812,7 @@ bool parseEntitySpawnPayload(
     
     // Parse heading
     try {
-        outData.heading = std::stof(tokens[7]);
+        outData.heading = toFloat(tokens[7]);
     } catch (...) {
         req::shared::logError("Protocol", "EntitySpawn: failed to parse heading");
         return false;
@@ -414,7 +826,7 @@ bool parseEntitySpawnPayload(
     
     // Parse hp
     try {
-        outData.hp = std::stoi(tokens[9]);
+        outData.hp = toInt(tokens[9]);
     } catch (...) {
         req::shared::logError("Protocol", "EntitySpawn: failed to parse hp");
         return false;
@@ -422,7 +834,7 @@ bool parseEntitySpawnPayload(
     
     // Parse maxHp
     try {
-        outData.maxHp = std::stoi(tokens[10]);
+        outData.maxHp = toInt(tokens[10]);
     } catch (...) {
         req::shared::logError("Protocol", "EntitySpawn: failed to parse maxHp");
         return false;
@@ -439,7 +851,34 @@ bool parseEntitySpawnPayload(
 // ============================================================================
 
 std::string buildEntityUpdatePayload(
-    const EntityUpdateData& data) {
+    const EntityUpdateData& data,
+    WireFormat format,
+    const QuantizationParams* quantization) {
+    if (format == WireFormat::Binary && quantization) {
+        std::string out = beginQuantizedPayload(23);
+        ByteWriter w(out);
+        w.writeU64(data.entityId);
+        writeQuantizedField(w, QuantizedField::PosX, data.posX, *quantization);
+        writeQuantizedField(w, QuantizedField::PosY, data.posY, *quantization);
+        writeQuantizedField(w, QuantizedField::PosZ, data.posZ, *quantization);
+        writeQuantizedField(w, QuantizedField::Yaw, data.heading, *quantization);
+        w.writeI32(data.hp);
+        w.writeU8(data.state);
+        return out;
+    }
+    if (format == WireFormat::Binary) {
+        std::string out = beginBinaryPayload(30);
+        ByteWriter w(out);
+        w.writeU64(data.entityId);
+        w.writeF32(data.posX);
+        w.writeF32(data.posY);
+        w.writeF32(data.posZ);
+        w.writeF32(data.heading);
+        w.writeI32(data.hp);
+        w.writeU8(data.state);
+        return out;
+    }
+    
     std::ostringstream oss;
     oss << data.entityId << '|'
         << data.posX << '|'
@@ -452,8 +891,47 @@ std::string buildEntityUpdatePayload(
 }
 
 bool parseEntityUpdatePayload(
-    const std::string& payload,
-    EntityUpdateData& outData) {
+    std::string_view payload,
+    EntityUpdateData& outData,
+    const QuantizationParams* quantization) {
+    if (isQuantizedPayload(payload)) {
+        if (!requireQuantization(quantization, "EntityUpdate")) {
+            return false;
+        }
+        ByteReader r(payload);
+        r.readU8();  // marker
+        outData.entityId = r.readU64();
+        outData.posX = readQuantizedField(r, QuantizedField::PosX, *quantization);
+        outData.posY = readQuantizedField(r, QuantizedField::PosY, *quantization);
+        outData.posZ = readQuantizedField(r, QuantizedField::PosZ, *quantization);
+        outData.heading = readQuantizedField(r, QuantizedField::Yaw, *quantization);
+        outData.hp = r.readI32();
+        outData.state = r.readU8();
+        if (!r.ok()) {
+            req::shared::logError("Protocol", "EntityUpdate: truncated quantized payload (" +
+                std::to_string(payload.size()) + " bytes)");
+            return false;
+        }
+        return true;
+    }
+    if (isBinaryPayload(payload)) {
+        ByteReader r(payload);
+        r.readU8();  // marker
+        outData.entityId = r.readU64();
+        outData.posX = r.readF32();
+        outData.posY = r.readF32();
+        outData.posZ = r.readF32();
+        outData.heading = r.readF32();
+        outData.hp = r.readI32();
+        outData.state = r.readU8();
+        if (!r.ok()) {
+            req::shared::logError("Protocol", "EntityUpdate: truncated binary payload (" +
+                std::to_string(payload.size()) + " bytes)");
+            return false;
+        }
+        return true;
+    }
+    
     auto tokens = split(payload, '|');
     if (tokens.size() < 7) {
         req::shared::logError("Protocol", std::string{"EntityUpdate: expected 7 fields, got "} + 
@@ -469,9 +947,9 @@ bool parseEntityUpdatePayload(
     
     // Parse position (posX, posY, posZ)
     try {
-        outData.posX = std::stof(tokens[1]);
-        outData.posY = std::stof(tokens[2]);
-        outData.posZ = std::stof(tokens[3]);
+        outData.posX = toFloat(tokens[1]);
+        outData.posY = toFloat(tokens[2]);
+        outData.posZ = toFloat(tokens[3]);
     } catch (...) {
         req::shared::logError("Protocol", "EntityUpdate: failed to parse position");
         return false;
@@ -479,7 +957,7 @@ bool parseEntityUpdatePayload(
     
     // Parse heading
     try {
-        outData.heading = std::stof(tokens[4]);
+        outData.heading = toFloat(tokens[4]);
     } catch (...) {
         req::shared::logError("Protocol", "EntityUpdate: failed to parse heading");
         return false;
@@ -487,7 +965,7 @@ bool parseEntityUpdatePayload(
     
     // Parse hp
     try {
-        outData.hp = std::stoi(tokens[5]);
+        outData.hp = toInt(tokens[5]);
     } catch (...) {
         req::shared::logError("Protocol", "EntityUpdate: failed to parse hp");
         return false;
@@ -516,7 +994,7 @@ std::string buildEntityDespawnPayload(
 }
 
 bool parseEntityDespawnPayload(
-    const std::string& payload,
+    std::string_view payload,
     EntityDespawnData& outData) {
     auto tokens = split(payload, '|');
     if (tokens.size() < 2) {
@@ -540,4 +1018,118 @@ bool parseEntityDespawnPayload(
     return true;
 }
 
+// ============================================================================
+// Ping / Pong
+// ============================================================================
+
+std::string buildZonePingPayload(
+    const ZonePingData& data) {
+    std::ostringstream oss;
+    oss << data.pingId << '|' << data.serverTimeMs;
+    return oss.str();
+}
+
+bool parseZonePingPayload(
+    std::string_view payload,
+    ZonePingData& outData) {
+    auto tokens = split(payload, '|');
+    if (tokens.size() < 2) {
+        req::shared::logError("Protocol", std::string{"Ping: expected 2 fields, got "} +
+            std::to_string(tokens.size()));
+        return false;
+    }
+    
+    if (!parseUInt(tokens[0], outData.pingId) || !parseUInt(tokens[1], outData.serverTimeMs)) {
+        req::shared::logError("Protocol", "Ping: failed to parse fields");
+        return false;
+    }
+    
+    return true;
+}
+
+std::string buildZonePongPayload(
+    const ZonePongData& data) {
+    std::ostringstream oss;
+    oss << data.pingId << '|' << data.serverTimeMs << '|' << data.clientTimeMs;
+    return oss.str();
+}
+
+bool parseZonePongPayload(
+    std::string_view payload,
+    ZonePongData& outData) {
+    auto tokens = split(payload, '|');
+    if (tokens.size() < 3) {
+        req::shared::logError("Protocol", std::string{"Pong: expected 3 fields, got "} +
+            std::to_string(tokens.size()));
+        return false;
+    }
+    
+    if (!parseUInt(tokens[0], outData.pingId) ||
+        !parseUInt(tokens[1], outData.serverTimeMs) ||
+        !parseUInt(tokens[2], outData.clientTimeMs)) {
+        req::shared::logError("Protocol", "Pong: failed to parse fields");
+        return false;
+    }
+    
+    return true;
+}
+
+// ============================================================================
+// UDP Side-Channel
+// ============================================================================
+
+std::string buildDatagram(
+    const DatagramHeader& header,
+    std::string_view frame) {
+    std::string out;
+    out.reserve(DatagramHeaderBytes + frame.size());
+    req::shared::ByteWriter w(out);
+    w.writeU32(DatagramMagic);
+    w.writeU8(static_cast<std::uint8_t>(header.kind));
+    w.writeU64(header.characterId);
+    w.writeU64(header.sessionKey);
+    w.writeU32(header.sequence);
+    if (header.kind == DatagramKind::Message) {
+        out.append(frame.data(), frame.size());
+    }
+    return out;
+}
+
+bool parseDatagram(
+    std::string_view datagram,
+    DatagramHeader& outHeader,
+    MessageHeader& outMessageHeader,
+    std::string_view& outPayload) {
+    // Datagrams arrive from unauthenticated endpoints: reject quietly, no logging
+    req::shared::ByteReader r(datagram);
+    if (r.readU32() != DatagramMagic) {
+        return false;
+    }
+    std::uint8_t kind = r.readU8();
+    outHeader.characterId = r.readU64();
+    outHeader.sessionKey = r.readU64();
+    outHeader.sequence = r.readU32();
+    if (!r.ok() || kind < static_cast<std::uint8_t>(DatagramKind::Hello) ||
+        kind > static_cast<std::uint8_t>(DatagramKind::Message)) {
+        return false;
+    }
+    outHeader.kind = static_cast<DatagramKind>(kind);
+    outPayload = {};
+
+    if (outHeader.kind != DatagramKind::Message) {
+        return true;
+    }
+
+    std::string_view frame = datagram.substr(DatagramHeaderBytes);
+    if (frame.size() < sizeof(MessageHeader)) {
+        return false;
+    }
+    std::memcpy(&outMessageHeader, frame.data(), sizeof(MessageHeader));
+    if (outMessageHeader.payloadSize != frame.size() - sizeof(MessageHeader)) {
+        return false;
+    }
+    outPayload = frame.substr(sizeof(MessageHeader));
+    return true;
+}
+
 } // namespace req::shared::protocol
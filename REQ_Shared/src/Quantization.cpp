@@ -0,0 +1,232 @@
+#include "../include/req/shared/Quantization.h"
+#include "../include/req/shared/ProtocolParse.h"
+#include "../include/req/shared/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace req::shared::protocol {
+
+namespace {
+    using detail::split;
+    using detail::parseUInt;
+    using detail::toFloat;
+
+    std::uint32_t maxUnsigned(std::uint8_t bits) {
+        return bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+    }
+
+    std::int32_t maxSigned(std::uint8_t bits) {
+        return static_cast<std::int32_t>((1u << (bits - 1)) - 1u);
+    }
+
+    void writeUnsigned(ByteWriter& writer, std::uint32_t value, std::size_t bytes) {
+        for (std::size_t i = 0; i < bytes; ++i) {
+            writer.writeU8(static_cast<std::uint8_t>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    std::uint32_t readUnsigned(ByteReader& reader, std::size_t bytes) {
+        std::uint32_t value = 0;
+        for (std::size_t i = 0; i < bytes; ++i) {
+            value |= static_cast<std::uint32_t>(reader.readU8()) << (8 * i);
+        }
+        return value;
+    }
+
+    // Sign-extend a two's complement value stored in 'bits'
+    std::int32_t signExtend(std::uint32_t value, std::uint8_t bits) {
+        std::uint32_t signBit = 1u << (bits - 1);
+        return static_cast<std::int32_t>((value ^ signBit) - signBit);
+    }
+
+    void axisBounds(QuantizedField field, const QuantizationParams& params, float& outMin, float& outMax) {
+        switch (field) {
+        case QuantizedField::PosX: outMin = params.boundsMinX; outMax = params.boundsMaxX; break;
+        case QuantizedField::PosY: outMin = params.boundsMinY; outMax = params.boundsMaxY; break;
+        default:                   outMin = params.boundsMinZ; outMax = params.boundsMaxZ; break;
+        }
+    }
+
+    bool isPosition(QuantizedField field) {
+        return field == QuantizedField::PosX || field == QuantizedField::PosY || field == QuantizedField::PosZ;
+    }
+}
+
+std::string validateQuantizationParams(const QuantizationParams& params) {
+    if (params.positionBits != 16 && params.positionBits != 24) {
+        return "position_bits must be 16 or 24, got " + std::to_string(params.positionBits);
+    }
+    if (params.yawBits != 8 && params.yawBits != 16) {
+        return "yaw_bits must be 8 or 16, got " + std::to_string(params.yawBits);
+    }
+    if (params.velocityBits != 8 && params.velocityBits != 16) {
+        return "velocity_bits must be 8 or 16, got " + std::to_string(params.velocityBits);
+    }
+    if (!(params.boundsMaxX > params.boundsMinX) || !(params.boundsMaxY > params.boundsMinY) ||
+        !(params.boundsMaxZ > params.boundsMinZ)) {
+        return "bounds max must be greater than bounds min on every axis";
+    }
+    if (!(params.maxSpeed > 0.0f)) {
+        return "max_speed must be positive, got " + std::to_string(params.maxSpeed);
+    }
+    return {};
+}
+
+std::string buildQuantizationParamsField(const QuantizationParams& params) {
+    // 9 significant digits round-trip a float exactly, so both ends quantize alike
+    std::ostringstream oss;
+    oss << std::setprecision(9) << params.boundsMinX << ',' << params.boundsMinY << ',' << params.boundsMinZ << ','
+        << params.boundsMaxX << ',' << params.boundsMaxY << ',' << params.boundsMaxZ << ','
+        << static_cast<std::uint32_t>(params.positionBits) << ','
+        << static_cast<std::uint32_t>(params.yawBits) << ','
+        << static_cast<std::uint32_t>(params.velocityBits) << ','
+        << params.maxSpeed;
+    return oss.str();
+}
+
+bool parseQuantizationParamsField(std::string_view field, QuantizationParams& outParams) {
+    auto tokens = split(field, ',');
+    if (tokens.size() < 10) {
+        req::shared::logError("Protocol", "QuantizationParams: expected 10 fields, got " + std::to_string(tokens.size()));
+        return false;
+    }
+
+    QuantizationParams params;
+    std::uint32_t positionBits = 0;
+    std::uint32_t yawBits = 0;
+    std::uint32_t velocityBits = 0;
+    try {
+        params.boundsMinX = toFloat(tokens[0]);
+        params.boundsMinY = toFloat(tokens[1]);
+        params.boundsMinZ = toFloat(tokens[2]);
+        params.boundsMaxX = toFloat(tokens[3]);
+        params.boundsMaxY = toFloat(tokens[4]);
+        params.boundsMaxZ = toFloat(tokens[5]);
+        params.maxSpeed = toFloat(tokens[9]);
+    } catch (...) {
+        req::shared::logError("Protocol", "QuantizationParams: failed to parse bounds/maxSpeed");
+        return false;
+    }
+    if (!parseUInt(tokens[6], positionBits) || !parseUInt(tokens[7], yawBits) || !parseUInt(tokens[8], velocityBits)) {
+        req::shared::logError("Protocol", "QuantizationParams: failed to parse bit widths");
+        return false;
+    }
+    params.positionBits = static_cast<std::uint8_t>(std::min<std::uint32_t>(positionBits, 0xFF));
+    params.yawBits = static_cast<std::uint8_t>(std::min<std::uint32_t>(yawBits, 0xFF));
+    params.velocityBits = static_cast<std::uint8_t>(std::min<std::uint32_t>(velocityBits, 0xFF));
+
+    std::string error = validateQuantizationParams(params);
+    if (!error.empty()) {
+        req::shared::logError("Protocol", "QuantizationParams: " + error);
+        return false;
+    }
+    outParams = params;
+    return true;
+}
+
+std::uint32_t quantizePosition(float value, float boundsMin, float boundsMax, std::uint8_t bits) {
+    const std::uint32_t steps = maxUnsigned(bits);
+    float normalized = (value - boundsMin) / (boundsMax - boundsMin);
+    normalized = std::clamp(normalized, 0.0f, 1.0f);
+    if (!(normalized >= 0.0f)) {
+        normalized = 0.0f;  // NaN
+    }
+    return static_cast<std::uint32_t>(std::lround(static_cast<double>(normalized) * steps));
+}
+
+float dequantizePosition(std::uint32_t quantized, float boundsMin, float boundsMax, std::uint8_t bits) {
+    const std::uint32_t steps = maxUnsigned(bits);
+    double normalized = static_cast<double>(std::min(quantized, steps)) / steps;
+    return static_cast<float>(boundsMin + normalized * (static_cast<double>(boundsMax) - boundsMin));
+}
+
+std::uint32_t quantizeYaw(float degrees, std::uint8_t bits) {
+    const double range = static_cast<double>(maxUnsigned(bits)) + 1.0;
+    double wrapped = std::fmod(static_cast<double>(degrees), 360.0);
+    if (wrapped < 0.0) {
+        wrapped += 360.0;
+    }
+    if (!(wrapped >= 0.0)) {
+        wrapped = 0.0;  // NaN
+    }
+    // 360 degrees wraps back to 0
+    return static_cast<std::uint32_t>(std::llround(wrapped / 360.0 * range)) & maxUnsigned(bits);
+}
+
+float dequantizeYaw(std::uint32_t quantized, std::uint8_t bits) {
+    const double range = static_cast<double>(maxUnsigned(bits)) + 1.0;
+    return static_cast<float>((quantized & maxUnsigned(bits)) * 360.0 / range);
+}
+
+std::int32_t quantizeVelocity(float value, float maxSpeed, std::uint8_t bits) {
+    const std::int32_t limit = maxSigned(bits);
+    float normalized = std::clamp(value / maxSpeed, -1.0f, 1.0f);
+    if (!(normalized >= -1.0f)) {
+        normalized = 0.0f;  // NaN
+    }
+    return static_cast<std::int32_t>(std::lround(normalized * static_cast<float>(limit)));
+}
+
+float dequantizeVelocity(std::int32_t quantized, float maxSpeed, std::uint8_t bits) {
+    const std::int32_t limit = maxSigned(bits);
+    return static_cast<float>(std::clamp(quantized, -limit, limit)) / static_cast<float>(limit) * maxSpeed;
+}
+
+std::size_t quantizedFieldBytes(QuantizedField field, const QuantizationParams& params) {
+    if (isPosition(field)) {
+        return params.positionBits / 8u;
+    }
+    if (field == QuantizedField::Yaw) {
+        return params.yawBits / 8u;
+    }
+    return params.velocityBits / 8u;
+}
+
+void writeQuantizedField(ByteWriter& writer, QuantizedField field, float value, const QuantizationParams& params) {
+    const std::size_t bytes = quantizedFieldBytes(field, params);
+    if (isPosition(field)) {
+        float boundsMin = 0.0f;
+        float boundsMax = 0.0f;
+        axisBounds(field, params, boundsMin, boundsMax);
+        writeUnsigned(writer, quantizePosition(value, boundsMin, boundsMax, params.positionBits), bytes);
+    } else if (field == QuantizedField::Yaw) {
+        writeUnsigned(writer, quantizeYaw(value, params.yawBits), bytes);
+    } else {
+        writeUnsigned(writer, static_cast<std::uint32_t>(quantizeVelocity(value, params.maxSpeed, params.velocityBits)), bytes);
+    }
+}
+
+float readQuantizedField(ByteReader& reader, QuantizedField field, const QuantizationParams& params) {
+    const std::size_t bytes = quantizedFieldBytes(field, params);
+    std::uint32_t raw = readUnsigned(reader, bytes);
+    if (isPosition(field)) {
+        float boundsMin = 0.0f;
+        float boundsMax = 0.0f;
+        axisBounds(field, params, boundsMin, boundsMax);
+        return dequantizePosition(raw, boundsMin, boundsMax, params.positionBits);
+    }
+    if (field == QuantizedField::Yaw) {
+        return dequantizeYaw(raw, params.yawBits);
+    }
+    return dequantizeVelocity(signExtend(raw, params.velocityBits), params.maxSpeed, params.velocityBits);
+}
+
+float snapToQuantized(QuantizedField field, float value, const QuantizationParams& params) {
+    if (isPosition(field)) {
+        float boundsMin = 0.0f;
+        float boundsMax = 0.0f;
+        axisBounds(field, params, boundsMin, boundsMax);
+        return dequantizePosition(quantizePosition(value, boundsMin, boundsMax, params.positionBits),
+            boundsMin, boundsMax, params.positionBits);
+    }
+    if (field == QuantizedField::Yaw) {
+        return dequantizeYaw(quantizeYaw(value, params.yawBits), params.yawBits);
+    }
+    return dequantizeVelocity(quantizeVelocity(value, params.maxSpeed, params.velocityBits),
+        params.maxSpeed, params.velocityBits);
+}
+
+} // namespace req::shared::protocol
@@ -42,6 +42,24 @@ public:
     
     // Negative test mode: sends intentionally invalid requests to verify error handling
     void runNegativeTests();
+    
+    // UDP side-channel test: ClientCore session with optional artificial datagram loss
+    void runUdpChannelTest(float simulatedLossPercent);
+    
+    // Offline benchmark: bytes per entity for text / f32 binary / quantized state
+    void runQuantizationBenchmark(int entityCount);
+    
+    // Offline benchmark: vectorized player motion kernel vs. scalar reference vs. old per-player loop
+    void runMotionBenchmark(int playerCount);
+    
+    // Offline benchmark: tick pass, lookups and churn over NPCs in std::unordered_map vs. DenseMap
+    void runEntityStorageBenchmark(int npcCount);
+    
+    // Offline check: HateList against a std::map reference over randomized add/remove sequences
+    void runHateListCheck(int sequenceCount);
+    
+    // Offline check: zone TimerWheel against a brute-force reference under stalls, clock jumps and back steps
+    void runTimerWheelCheck(int sequenceCount);
 
 private:
     using Tcp = boost::asio::ip::tcp;
@@ -0,0 +1,214 @@
+// HateList check for REQ_TestClient
+// Offline: replays randomized add/remove sequences on a HateList and on a
+// std::map reference and compares contents and top target after every step.
+// Id ranges are picked so lists keep crossing InlineCapacity (spill to the
+// heap vector and shrink back), and the top entry is removed on purpose.
+// Hate amounts are small integers under a low cap, so ties are common. No
+// servers are needed.
+
+#include "../include/req/testclient/TestClient.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+#include "../../REQ_Shared/include/req/shared/HateList.h"
+
+namespace req::testclient {
+
+namespace {
+    using req::shared::data::HateList;
+
+    constexpr int STEPS_PER_SEQUENCE = 2000;
+    constexpr float MAX_HATE = 40.0f;
+
+    struct Reference {
+        std::map<std::uint64_t, float> hates;
+        std::uint64_t top{ 0 };  // 0 = unknown until the list picks one (rescan)
+    };
+
+    struct Counts {
+        std::uint64_t steps{ 0 };
+        std::uint64_t spills{ 0 };      // Adds that took the list past InlineCapacity
+        std::uint64_t topRemovals{ 0 };
+        std::uint64_t tiesKept{ 0 };    // Adds that tied the top without taking it
+    };
+
+    float referenceMax(const Reference& ref) {
+        float best = 0.0f;
+        for (const auto& [id, hate] : ref.hates) {
+            best = std::max(best, hate);
+        }
+        return best;
+    }
+
+    // Empty string when the list matches the reference
+    std::string compare(const HateList& list, Reference& ref) {
+        std::ostringstream err;
+        if (list.size() != ref.hates.size() || list.empty() != ref.hates.empty()) {
+            err << "size " << list.size() << " != " << ref.hates.size();
+            return err.str();
+        }
+
+        std::map<std::uint64_t, float> listed;
+        for (const auto& entry : list) {
+            if (!listed.emplace(entry.entityId, entry.hate).second) {
+                err << "entity " << entry.entityId << " listed twice";
+                return err.str();
+            }
+        }
+        if (listed != ref.hates) {
+            return "entries differ";
+        }
+        for (const auto& [id, hate] : ref.hates) {
+            if (!list.contains(id) || list.hateFor(id) != hate) {
+                err << "lookup of entity " << id << " differs";
+                return err.str();
+            }
+        }
+
+        if (ref.hates.empty()) {
+            if (list.topTarget() != 0 || list.topHate() != 0.0f) {
+                return "empty list has a top target";
+            }
+            ref.top = 0;
+            return {};
+        }
+        if (list.topHate() != referenceMax(ref) || ref.hates.at(list.topTarget()) != list.topHate()) {
+            err << "top " << list.topTarget() << " (" << list.topHate() << ") is not the maximum "
+                << referenceMax(ref);
+            return err.str();
+        }
+        if (ref.top != 0 && list.topTarget() != ref.top) {
+            err << "top changed from " << ref.top << " to " << list.topTarget() << " without being passed";
+            return err.str();
+        }
+        ref.top = list.topTarget();
+        return {};
+    }
+
+    void applyAdd(HateList& list, Reference& ref, std::uint64_t id, float amount, Counts& counts) {
+        bool isNew = ref.hates.find(id) == ref.hates.end();
+        if (isNew && list.size() == HateList::InlineCapacity) {
+            ++counts.spills;
+        }
+        float& hate = ref.hates[id];
+        hate = std::min(hate + amount, MAX_HATE);
+        if (ref.top != 0 && id != ref.top) {
+            float topHate = ref.hates.at(ref.top);
+            if (hate > topHate) {
+                ref.top = id;  // Only a strictly greater entry takes the top
+            } else if (hate == topHate) {
+                ++counts.tiesKept;
+            }
+        } else if (ref.top == 0) {
+            ref.top = id;
+        }
+        list.add(id, amount, MAX_HATE);
+    }
+
+    void applyRemove(HateList& list, Reference& ref, std::uint64_t id, Counts& counts) {
+        if (id == ref.top) {
+            ++counts.topRemovals;
+            ref.top = 0;  // Any entry with the maximum hate may follow
+        }
+        ref.hates.erase(id);
+        list.remove(id);
+    }
+
+    // One randomized sequence; 'idRange' sets how large the list can grow
+    std::string runSequence(std::mt19937& rng, std::uint64_t idRange, Counts& counts) {
+        HateList list;
+        Reference ref;
+        std::uniform_int_distribution<std::uint64_t> pickId(1, idRange);
+        std::uniform_int_distribution<int> pickAmount(0, 4);
+        std::uniform_int_distribution<int> pickOp(0, 99);
+
+        for (int step = 0; step < STEPS_PER_SEQUENCE; ++step) {
+            int op = pickOp(rng);
+            if (op < 60) {
+                applyAdd(list, ref, pickId(rng), static_cast<float>(pickAmount(rng)), counts);
+            } else if (op < 75 && ref.top != 0) {
+                applyRemove(list, ref, ref.top, counts);
+            } else if (op < 98) {
+                applyRemove(list, ref, pickId(rng), counts);
+            } else {
+                list.clear();
+                ref.hates.clear();
+                ref.top = 0;
+            }
+            ++counts.steps;
+
+            std::string err = compare(list, ref);
+            if (!err.empty()) {
+                return "step " + std::to_string(step) + ": " + err;
+            }
+        }
+        return {};
+    }
+
+    // Fixed case: fill the inline array, spill with a new top, then remove it
+    std::string runSpillCase() {
+        HateList list;
+        Reference ref;
+        Counts counts;
+        for (std::uint64_t id = 1; id <= HateList::InlineCapacity; ++id) {
+            applyAdd(list, ref, id, static_cast<float>(id % 5), counts);
+        }
+        applyAdd(list, ref, 100, MAX_HATE, counts);
+        std::string err = compare(list, ref);
+        if (err.empty() && list.topTarget() != 100) {
+            err = "spilled entry did not take the top";
+        }
+        if (err.empty()) {
+            applyRemove(list, ref, 100, counts);
+            err = compare(list, ref);
+        }
+        while (err.empty() && !ref.hates.empty()) {
+            applyRemove(list, ref, ref.hates.begin()->first, counts);
+            err = compare(list, ref);
+        }
+        if (err.empty()) {
+            applyAdd(list, ref, 7, 1.0f, counts);  // Back to inline storage
+            err = compare(list, ref);
+        }
+        return err;
+    }
+}
+
+void TestClient::runHateListCheck(int sequenceCount) {
+    req::shared::logInfo("TestClient", "=== HATE LIST CHECK ===");
+    std::cout << "\n=== Hate List Check (" << sequenceCount << " sequences x " << STEPS_PER_SEQUENCE
+              << " steps) ===\n";
+
+    bool ok = true;
+    std::string err = runSpillCase();
+    std::cout << "Spill past inline capacity, remove top, shrink to empty: " << (err.empty() ? "ok" : "FAILED: " + err)
+              << "\n";
+    ok = ok && err.empty();
+
+    std::mt19937 rng(4242);
+    Counts counts;
+    for (int i = 0; i < sequenceCount && ok; ++i) {
+        // Ranges below, around and well above InlineCapacity
+        std::uint64_t idRange = static_cast<std::uint64_t>(HateList::InlineCapacity) / 2 + rng() % (HateList::InlineCapacity * 3);
+        err = runSequence(rng, idRange, counts);
+        if (!err.empty()) {
+            std::cout << "Sequence " << i << " (ids 1-" << idRange << ") FAILED: " << err << "\n";
+            ok = false;
+        }
+    }
+
+    std::cout << "Randomized: " << counts.steps << " steps, " << counts.spills << " adds past inline capacity, "
+              << counts.topRemovals << " top removals, " << counts.tiesKept << " ties kept\n";
+    std::cout << "Verify -> " << (ok ? "PASS" : "FAIL") << "\n";
+
+    req::shared::logInfo("TestClient", std::string{"Hate list check complete: "} + (ok ? "PASS" : "FAIL"));
+}
+
+} // namespace req::testclient
@@ -0,0 +1,206 @@
+// Player movement kernel benchmark for REQ_TestClient
+// Offline: checks the vectorized integrateMotion against the scalar reference
+// (bit for bit) and times both against the old per-player loop over a map of
+// large player structs. No servers are needed.
+
+#include "../include/req/testclient/TestClient.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+#include "../../REQ_Shared/include/req/shared/MotionKernel.h"
+
+namespace req::testclient {
+
+namespace {
+    using req::shared::MotionParams;
+    using req::shared::MotionTable;
+
+    constexpr int VERIFY_STEPS = 200;
+    constexpr int TIMED_STEPS = 2000;
+    constexpr float MOVING_FRACTION = 0.5f;   // Players holding a direction
+    constexpr float JUMPING_FRACTION = 0.1f;  // Players holding jump
+    constexpr float DEAD_FRACTION = 0.05f;    // Disabled rows
+
+    // Stand-in for ZonePlayer: the same hot fields surrounded by the cold
+    // ones (connection, stats, knownEntities, baselines...) in a hash map
+    struct MapPlayer {
+        float posX{ 0.0f }, posY{ 0.0f }, posZ{ 0.0f };
+        float velX{ 0.0f }, velY{ 0.0f }, velZ{ 0.0f };
+        float lastValidPosX{ 0.0f }, lastValidPosY{ 0.0f }, lastValidPosZ{ 0.0f };
+        float inputX{ 0.0f }, inputY{ 0.0f };
+        bool isJumpPressed{ false };
+        bool isDead{ false };
+        bool isDirty{ false };
+        char cold[480]{};
+    };
+
+    MotionTable makeTable(int playerCount) {
+        std::mt19937 rng(4242);
+        std::uniform_real_distribution<float> coord(-5000.0f, 5000.0f);
+        std::uniform_real_distribution<float> input(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        MotionTable table;
+        for (int i = 0; i < playerCount; ++i) {
+            auto slot = table.add(1000 + static_cast<std::uint64_t>(i));
+            table.posX[slot] = table.lastValidX[slot] = coord(rng);
+            table.posY[slot] = table.lastValidY[slot] = coord(rng);
+            if (unit(rng) < MOVING_FRACTION) {
+                table.inputX[slot] = input(rng);
+                table.inputY[slot] = input(rng);
+            }
+            table.jump[slot] = unit(rng) < JUMPING_FRACTION ? 1 : 0;
+            table.enabled[slot] = unit(rng) < DEAD_FRACTION ? 0 : 1;
+        }
+        // A few teleporters so the snap-back path runs too
+        for (int i = 7; i < playerCount; i += 97) {
+            table.lastValidX[i] += 1000.0f;
+        }
+        return table;
+    }
+
+    std::uint64_t countMismatches(const MotionTable& a, const MotionTable& b) {
+        auto same = [](const std::vector<float>& x, const std::vector<float>& y, std::size_t i) {
+            return std::memcmp(&x[i], &y[i], sizeof(float)) == 0;
+        };
+        std::uint64_t mismatches = 0;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (!same(a.posX, b.posX, i) || !same(a.posY, b.posY, i) || !same(a.posZ, b.posZ, i) ||
+                !same(a.velX, b.velX, i) || !same(a.velY, b.velY, i) || !same(a.velZ, b.velZ, i) ||
+                !same(a.lastValidX, b.lastValidX, i) || !same(a.lastValidY, b.lastValidY, i) ||
+                !same(a.lastValidZ, b.lastValidZ, i) || !same(a.moveDist, b.moveDist, i) ||
+                a.flags[i] != b.flags[i]) {
+                ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+
+    // The per-player loop updateSimulation ran before the motion table
+    void stepMapPlayers(std::unordered_map<std::uint64_t, MapPlayer>& players, const MotionParams& p) {
+        const float maxAllowedMove = p.moveSpeed * p.dt * p.maxAllowedMoveMultiplier;
+        const float suspiciousThreshold = maxAllowedMove * p.suspiciousMoveMultiplier;
+        for (auto& [id, player] : players) {
+            if (player.isDead) {
+                continue;
+            }
+            float inputLength = std::sqrt(player.inputX * player.inputX + player.inputY * player.inputY);
+            float dirX = player.inputX;
+            float dirY = player.inputY;
+            if (inputLength > 1.0f) {
+                dirX /= inputLength;
+                dirY /= inputLength;
+            }
+            player.velX = dirX * p.moveSpeed;
+            player.velY = dirY * p.moveSpeed;
+            if (player.posZ <= p.groundLevel) {
+                player.velZ = player.isJumpPressed ? p.jumpVelocity : 0.0f;
+            } else {
+                player.velZ += p.gravity * p.dt;
+            }
+            float newX = player.posX + player.velX * p.dt;
+            float newY = player.posY + player.velY * p.dt;
+            float newZ = player.posZ + player.velZ * p.dt;
+            if (newZ <= p.groundLevel) {
+                newZ = p.groundLevel;
+                player.velZ = 0.0f;
+            }
+            float dx = newX - player.lastValidPosX;
+            float dy = newY - player.lastValidPosY;
+            float dz = newZ - player.lastValidPosZ;
+            float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (dist > suspiciousThreshold) {
+                player.posX = player.lastValidPosX;
+                player.posY = player.lastValidPosY;
+                player.posZ = player.lastValidPosZ;
+                player.velX = player.velY = player.velZ = 0.0f;
+            } else {
+                player.posX = player.lastValidPosX = newX;
+                player.posY = player.lastValidPosY = newY;
+                player.posZ = player.lastValidPosZ = newZ;
+                if (dist > 0.01f) {
+                    player.isDirty = true;
+                }
+            }
+        }
+    }
+
+    template<typename Fn>
+    double nanosPerRowStep(int rows, Fn&& step) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < TIMED_STEPS; ++i) {
+            step();
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return elapsed / (static_cast<double>(TIMED_STEPS) * rows);
+    }
+
+    void printRow(const char* label, double nanos, double baseline) {
+        char line[160];
+        std::snprintf(line, sizeof(line), "  %-38s %8.2f ns/player/step  %6.2fx\n", label, nanos, baseline / nanos);
+        std::cout << line;
+    }
+}
+
+void TestClient::runMotionBenchmark(int playerCount) {
+    req::shared::logInfo("TestClient", "=== MOTION KERNEL BENCHMARK ===");
+    std::cout << "\n=== Player Motion Kernel Benchmark (" << playerCount << " players) ===\n";
+    std::cout << "Vectorized path: " << (req::shared::motionKernelIsVectorized() ? "SSE2" : "none (scalar only)") << "\n";
+
+    MotionParams params;
+    MotionTable table = makeTable(playerCount);
+
+    // Correctness: kernel and scalar reference must agree bit for bit
+    {
+        MotionTable vectorized = table;
+        MotionTable reference = table;
+        std::uint64_t mismatches = 0;
+        std::uint64_t snapBacks = 0;
+        for (int step = 0; step < VERIFY_STEPS; ++step) {
+            req::shared::integrateMotion(vectorized, params);
+            req::shared::integrateMotionScalar(reference, params);
+            mismatches += countMismatches(vectorized, reference);
+            for (auto flags : vectorized.flags) {
+                snapBacks += (flags & req::shared::MotionFlag::SnappedBack) ? 1 : 0;
+            }
+        }
+        std::cout << "\nVerify (" << VERIFY_STEPS << " steps): " << mismatches << " mismatching rows, "
+                  << snapBacks << " snap-backs exercised -> " << (mismatches == 0 ? "PASS" : "FAIL") << "\n";
+    }
+
+    // Timing
+    std::unordered_map<std::uint64_t, MapPlayer> mapPlayers;
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        MapPlayer& player = mapPlayers[table.ids[i]];
+        player.posX = player.lastValidPosX = table.lastValidX[i];
+        player.posY = player.lastValidPosY = table.lastValidY[i];
+        player.inputX = table.inputX[i];
+        player.inputY = table.inputY[i];
+        player.isJumpPressed = table.jump[i] != 0;
+        player.isDead = table.enabled[i] == 0;
+    }
+    MotionTable scalarTable = table;
+    MotionTable vectorTable = table;
+
+    double mapNanos = nanosPerRowStep(playerCount, [&] { stepMapPlayers(mapPlayers, params); });
+    double scalarNanos = nanosPerRowStep(playerCount, [&] { req::shared::integrateMotionScalar(scalarTable, params); });
+    double vectorNanos = nanosPerRowStep(playerCount, [&] { req::shared::integrateMotion(vectorTable, params); });
+
+    std::cout << "\nTiming (" << TIMED_STEPS << " steps):\n";
+    printRow("map of player structs (old loop)", mapNanos, mapNanos);
+    printRow("motion table, scalar reference", scalarNanos, mapNanos);
+    printRow("motion table, integrateMotion", vectorNanos, mapNanos);
+
+    req::shared::logInfo("TestClient", "Motion benchmark complete: players=" + std::to_string(playerCount));
+}
+
+} // namespace req::testclient
@@ -0,0 +1,201 @@
+// State quantization benchmark for REQ_TestClient
+// Offline: encodes the same synthetic zone state as text, f32 binary and
+// quantized binary and reports bytes per entity and the worst decode error.
+// No servers are needed.
+
+#include "../include/req/testclient/TestClient.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+#include "../../REQ_Shared/include/req/shared/ProtocolSchemas.h"
+
+namespace req::testclient {
+
+namespace {
+    using req::shared::protocol::PlayerStateEntry;
+    using req::shared::protocol::PlayerStateSnapshotData;
+    using req::shared::protocol::QuantizationParams;
+    using req::shared::protocol::WireFormat;
+
+    constexpr int ENCODE_ITERATIONS = 200;
+    constexpr float MOVING_FRACTION = 0.25f;  // Share of entities that move between two snapshots
+    constexpr float MOVE_SPEED = 70.0f;       // ZoneConfig default move_speed
+    constexpr float TICK_SEC = 0.05f;
+
+    struct QuantizationCase {
+        const char* label;
+        QuantizationParams params;
+    };
+
+    QuantizationParams makeParams(std::uint8_t positionBits, std::uint8_t yawBits, std::uint8_t velocityBits) {
+        QuantizationParams params;
+        params.positionBits = positionBits;
+        params.yawBits = yawBits;
+        params.velocityBits = velocityBits;
+        return params;
+    }
+
+    PlayerStateSnapshotData makeSnapshot(int entityCount, std::mt19937& rng, const QuantizationParams& bounds) {
+        std::uniform_real_distribution<float> x(bounds.boundsMinX, bounds.boundsMaxX);
+        std::uniform_real_distribution<float> y(bounds.boundsMinY, bounds.boundsMaxY);
+        std::uniform_real_distribution<float> z(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        PlayerStateSnapshotData snapshot;
+        snapshot.snapshotId = 1;
+        for (int i = 0; i < entityCount; ++i) {
+            PlayerStateEntry entry;
+            entry.characterId = 1000 + static_cast<std::uint64_t>(i);
+            entry.posX = x(rng);
+            entry.posY = y(rng);
+            entry.posZ = z(rng);
+            entry.yawDegrees = angle(rng);
+            if (unit(rng) < MOVING_FRACTION) {
+                float radians = entry.yawDegrees * 3.14159265f / 180.0f;
+                entry.velX = std::cos(radians) * MOVE_SPEED;
+                entry.velY = std::sin(radians) * MOVE_SPEED;
+            }
+            snapshot.players.push_back(entry);
+        }
+        return snapshot;
+    }
+
+    // One tick later: moving entities advance by their velocity
+    PlayerStateSnapshotData advance(const PlayerStateSnapshotData& snapshot) {
+        PlayerStateSnapshotData next = snapshot;
+        next.snapshotId = snapshot.snapshotId + 1;
+        for (auto& entry : next.players) {
+            entry.posX += entry.velX * TICK_SEC;
+            entry.posY += entry.velY * TICK_SEC;
+        }
+        return next;
+    }
+
+    // Shortest angular distance, so 359.9 vs 0.0 counts as 0.1
+    float yawError(float a, float b) {
+        return std::fabs(std::fmod(a - b + 540.0f, 360.0f) - 180.0f);
+    }
+
+    void printRow(const char* label, std::size_t bytes, int entityCount, const std::string& note = {}) {
+        char line[160];
+        std::snprintf(line, sizeof(line), "  %-34s %9zu B  %7.2f B/entity  %s\n", label, bytes,
+            static_cast<double>(bytes) / entityCount, note.c_str());
+        std::cout << line;
+    }
+}
+
+void TestClient::runQuantizationBenchmark(int entityCount) {
+    using namespace req::shared::protocol;
+
+    req::shared::logInfo("TestClient", "=== QUANTIZATION BENCHMARK ===");
+    std::cout << "\n=== State Quantization Benchmark (" << entityCount << " entities) ===\n";
+
+    std::mt19937 rng(12345);
+    QuantizationParams defaults;
+    PlayerStateSnapshotData snapshot = makeSnapshot(entityCount, rng, defaults);
+    PlayerStateSnapshotData nextSnapshot = advance(snapshot);
+
+    const QuantizationCase cases[] = {
+        { "quantized 16/8/8 (pos/yaw/vel)",  makeParams(16, 8, 8) },
+        { "quantized 24/16/8 (zone default)", makeParams(24, 16, 8) },
+        { "quantized 24/16/16",               makeParams(24, 16, 16) },
+    };
+
+    std::cout << "Zone bounds: x/y " << defaults.boundsMinX << ".." << defaults.boundsMaxX
+              << ", z " << defaults.boundsMinZ << ".." << defaults.boundsMaxZ
+              << ", maxSpeed " << defaults.maxSpeed << "\n";
+
+    // PlayerStateSnapshot
+    std::cout << "\nPlayerStateSnapshot:\n";
+    printRow("text", buildPlayerStateSnapshotPayload(snapshot).size(), entityCount);
+    printRow("binary f32", buildPlayerStateSnapshotPayload(snapshot, WireFormat::Binary).size(), entityCount);
+    for (const auto& c : cases) {
+        std::string payload = buildPlayerStateSnapshotPayload(snapshot, WireFormat::Binary, &c.params);
+
+        PlayerStateSnapshotData decoded;
+        if (!parsePlayerStateSnapshotPayload(payload, decoded, &c.params) || decoded.players.size() != snapshot.players.size()) {
+            std::cout << "  " << c.label << ": DECODE FAILED\n";
+            continue;
+        }
+        float posError = 0.0f;
+        float velError = 0.0f;
+        float yawErr = 0.0f;
+        for (std::size_t i = 0; i < decoded.players.size(); ++i) {
+            const auto& a = snapshot.players[i];
+            const auto& b = decoded.players[i];
+            posError = std::max({ posError, std::fabs(a.posX - b.posX), std::fabs(a.posY - b.posY), std::fabs(a.posZ - b.posZ) });
+            velError = std::max({ velError, std::fabs(a.velX - b.velX), std::fabs(a.velY - b.velY), std::fabs(a.velZ - b.velZ) });
+            yawErr = std::max(yawErr, yawError(a.yawDegrees, b.yawDegrees));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::size_t encodedBytes = 0;
+        for (int i = 0; i < ENCODE_ITERATIONS; ++i) {
+            encodedBytes += buildPlayerStateSnapshotPayload(snapshot, WireFormat::Binary, &c.params).size();
+        }
+        auto encodeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count() / ENCODE_ITERATIONS;
+
+        char note[160];
+        std::snprintf(note, sizeof(note), "maxErr pos=%.4f vel=%.3f yaw=%.3f deg, encode=%lldus",
+            posError, velError, yawErr, static_cast<long long>(encodeUs));
+        printRow(c.label, encodedBytes / ENCODE_ITERATIONS, entityCount, note);
+    }
+
+    // PlayerStateDelta against the previous tick
+    std::cout << "\nPlayerStateDelta (" << static_cast<int>(MOVING_FRACTION * 100) << "% of entities moving):\n";
+    {
+        PlayerStateDeltaData delta;
+        delta.snapshotId = nextSnapshot.snapshotId;
+        delta.baselineSnapshotId = snapshot.snapshotId;
+        diffPlayerStates(snapshot.players, nextSnapshot.players, delta);
+        printRow("binary f32", buildPlayerStateDeltaPayload(delta).size(), entityCount,
+            std::to_string(delta.changed.size()) + " changed");
+    }
+    for (const auto& c : cases) {
+        auto baseline = snapshot.players;
+        auto current = nextSnapshot.players;
+        for (auto& entry : baseline) {
+            snapPlayerStateToQuantized(entry, c.params);
+        }
+        for (auto& entry : current) {
+            snapPlayerStateToQuantized(entry, c.params);
+        }
+        PlayerStateDeltaData delta;
+        delta.snapshotId = nextSnapshot.snapshotId;
+        delta.baselineSnapshotId = snapshot.snapshotId;
+        diffPlayerStates(baseline, current, delta);
+        printRow(c.label, buildPlayerStateDeltaPayload(delta, &c.params).size(), entityCount,
+            std::to_string(delta.changed.size()) + " changed");
+    }
+
+    // EntityUpdate (one NPC per message)
+    std::cout << "\nEntityUpdate (per message):\n";
+    EntityUpdateData update;
+    update.entityId = 5001;
+    update.posX = snapshot.players.front().posX;
+    update.posY = snapshot.players.front().posY;
+    update.posZ = snapshot.players.front().posZ;
+    update.heading = snapshot.players.front().yawDegrees;
+    update.hp = 1234;
+    update.state = 1;
+    printRow("text", buildEntityUpdatePayload(update).size(), 1);
+    printRow("binary f32", buildEntityUpdatePayload(update, WireFormat::Binary).size(), 1);
+    for (const auto& c : cases) {
+        printRow(c.label, buildEntityUpdatePayload(update, WireFormat::Binary, &c.params).size(), 1);
+    }
+
+    std::cout << "\n(payload bytes only; every message adds a 16-byte MessageHeader)\n";
+    req::shared::logInfo("TestClient", "Quantization benchmark complete: entities=" + std::to_string(entityCount));
+}
+
+} // namespace req::testclient
@@ -0,0 +1,150 @@
+// UDP side-channel scenario for REQ_TestClient
+// Drives a ClientCore session over the datagram channel (optionally with
+// artificial loss) and reports snapshot delivery vs. TCP fallback.
+
+#include "../include/req/testclient/TestClient.h"
+
+#include <req/clientcore/ClientCore.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <chrono>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+#include "../../REQ_Shared/include/req/shared/ProtocolSchemas.h"
+
+namespace req::testclient {
+
+namespace {
+    constexpr const char* DEFAULT_USERNAME = "testuser";
+    constexpr const char* DEFAULT_PASSWORD = "testpass";
+    constexpr const char* UDP_TEST_CHARACTER = "UdpTester";
+
+    constexpr int TEST_DURATION_SEC = 10;
+    constexpr auto SEND_INTERVAL = std::chrono::milliseconds(50);  // 20 Hz, same as the zone tick
+}
+
+void TestClient::runUdpChannelTest(float simulatedLossPercent) {
+    using namespace req::clientcore;
+
+    req::shared::logInfo("TestClient", "=== UDP SIDE-CHANNEL TEST ===");
+    std::cout << "\n=== UDP Side-Channel Test ===\n";
+    std::cout << "Client-side simulated loss: " << simulatedLossPercent << "%\n";
+    std::cout << "(Server-side loss is set with udp_simulated_loss_percent in the zone config)\n\n";
+
+    ClientConfig config{};
+    ClientSession session{};
+
+    // Login, registering the test account on first use
+    auto loginResp = login(config, DEFAULT_USERNAME, DEFAULT_PASSWORD,
+                           req::shared::protocol::LoginMode::Login, session);
+    if (loginResp.result == LoginResult::InvalidCredentials) {
+        loginResp = login(config, DEFAULT_USERNAME, DEFAULT_PASSWORD,
+                          req::shared::protocol::LoginMode::Register, session);
+    }
+    if (loginResp.result != LoginResult::Success) {
+        std::cout << "Login failed: " << loginResp.errorMessage << "\n";
+        return;
+    }
+
+    auto charList = getCharacterList(session);
+    if (charList.result != CharacterListResult::Success) {
+        std::cout << "Character list failed: " << charList.errorMessage << "\n";
+        return;
+    }
+
+    std::uint64_t characterId = 0;
+    if (!charList.characters.empty()) {
+        characterId = charList.characters.front().characterId;
+    } else {
+        auto created = createCharacter(session, UDP_TEST_CHARACTER, "Human", "Warrior");
+        if (created.result != CharacterListResult::Success) {
+            std::cout << "Character create failed: " << created.errorMessage << "\n";
+            return;
+        }
+        characterId = created.newCharacter.characterId;
+    }
+
+    auto enterResp = enterWorld(session, characterId);
+    if (enterResp.result != EnterWorldResult::Success) {
+        std::cout << "Enter world failed: " << enterResp.errorMessage << "\n";
+        return;
+    }
+
+    session.udpSimulatedLossPercent = simulatedLossPercent;
+    auto zoneResp = connectToZone(session);
+    if (zoneResp.result != ZoneAuthResult::Success) {
+        std::cout << "Zone auth failed: " << zoneResp.errorMessage << "\n";
+        return;
+    }
+
+    bool udpNegotiated = (session.zoneCapabilities & req::shared::protocol::ZoneCapability::UdpChannel) != 0;
+    std::cout << "Zone capabilities: " << session.zoneCapabilities
+              << (udpNegotiated ? " (UDP side-channel on port " + std::to_string(session.zoneUdpPort) + ")"
+                                : " (UDP not granted - zone has udp_enabled=false; everything stays on TCP)")
+              << "\n";
+
+    // Walk in a circle and count snapshot delivery
+    std::uint64_t snapshotsReceived = 0;
+    std::uint64_t snapshotsMissing = 0;
+    std::uint64_t lastSnapshotId = 0;
+    long long maxSnapshotGapMs = 0;
+    auto lastSnapshotTime = std::chrono::steady_clock::now();
+    std::uint32_t sequence = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + std::chrono::seconds(TEST_DURATION_SEC);
+    while (std::chrono::steady_clock::now() < end) {
+        float t = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        sendMovementIntent(session, std::cos(t), std::sin(t), std::fmod(t * 57.3f, 360.0f), false, ++sequence);
+
+        ZoneMessage msg;
+        while (tryReceiveZoneMessage(session, msg)) {
+            if (msg.type != req::shared::MessageType::PlayerStateSnapshot) {
+                continue;
+            }
+            req::shared::protocol::PlayerStateSnapshotData snapshot;
+            if (!parsePlayerStateSnapshot(msg.payload, snapshot)) {
+                continue;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            if (snapshotsReceived > 0) {
+                if (snapshot.snapshotId > lastSnapshotId + 1) {
+                    snapshotsMissing += snapshot.snapshotId - lastSnapshotId - 1;
+                }
+                maxSnapshotGapMs = std::max<long long>(maxSnapshotGapMs,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(now - lastSnapshotTime).count());
+            }
+            lastSnapshotId = std::max(lastSnapshotId, snapshot.snapshotId);
+            lastSnapshotTime = now;
+            ++snapshotsReceived;
+        }
+
+        std::this_thread::sleep_for(SEND_INTERVAL);
+    }
+
+    auto udpStats = getZoneUdpStats(session);
+    disconnectFromZone(session);
+
+    std::cout << "\n=== UDP Side-Channel Results (" << TEST_DURATION_SEC << "s) ===\n";
+    std::cout << "  Movement intents sent: " << sequence << "\n";
+    std::cout << "  Snapshots received:    " << snapshotsReceived << "\n";
+    std::cout << "  Snapshots skipped:     " << snapshotsMissing << "\n";
+    std::cout << "  Max snapshot gap:      " << maxSnapshotGapMs << " ms\n";
+    if (udpNegotiated) {
+        std::cout << "  UDP active at end:     " << (udpStats.active ? "yes" : "no") << "\n";
+        std::cout << "  Datagrams sent/recv:   " << udpStats.datagramsSent << " / " << udpStats.datagramsReceived << "\n";
+        std::cout << "  Stale datagrams:       " << udpStats.datagramsStale << "\n";
+        std::cout << "  Simulated loss drops:  " << udpStats.simulatedLossDrops << "\n";
+        std::cout << "  TCP fallback sends:    " << udpStats.tcpFallbackSends << "\n";
+    }
+
+    req::shared::logInfo("TestClient", std::string{"UDP test complete: snapshots="} + std::to_string(snapshotsReceived) +
+        ", skipped=" + std::to_string(snapshotsMissing) + ", maxGapMs=" + std::to_string(maxSnapshotGapMs) +
+        ", udpActive=" + (udpStats.active ? "true" : "false"));
+}
+
+} // namespace req::testclient
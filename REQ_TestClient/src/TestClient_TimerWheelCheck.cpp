@@ -0,0 +1,236 @@
+// TimerWheel check for REQ_TestClient
+// Offline: drives the zone's TimerWheel and a brute-force reference (a plain
+// list of pending timers, scanned on every advance) with the same randomized
+// schedules and clock. The clock mostly ticks at 20 Hz but also stalls, jumps
+// ahead by days (past the top level, into overflow), steps backwards, and the
+// wheel is reset and cleared. Every fourth sequence instead walks the clock in
+// steps just short of a re-file, so the wheel cascades through every level and
+// reaches the overflow list the slow way. After every advance the fired timers
+// are held to the TimerWheel contract:
+//   - each timer fires exactly once, never before its due time
+//   - anything due more than one resolution ago has fired
+//   - one advance returns its timers by due time, then scheduling order
+// No servers are needed.
+
+#include "../include/req/testclient/TestClient.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+#include "../../REQ_ZoneServer/include/req/zone/TimerWheel.h"
+
+namespace req::testclient {
+
+namespace {
+    using req::zone::TimerWheel;
+
+    constexpr int STEPS_PER_SEQUENCE = 3000;
+    constexpr double START_TIME = 1.7e9;   // Epoch seconds, like the zone's clock
+    constexpr double TIME_EPSILON = 1e-6;  // Double rounding at epoch magnitudes
+    constexpr double DAY = 86400.0;
+    
+    // Walking sequences: just under the 64 * 64 slots advance() steps through
+    // before it re-files instead, and enough steps to pass the top level
+    // (64^4 slots) at least once
+    constexpr std::uint64_t WALK_MIN_SLOTS = 4000;
+    constexpr std::uint64_t WALK_MAX_SLOTS = 4095;
+    constexpr int WALK_STEPS = 6000;
+
+    struct Pending {
+        double dueTime;
+        std::uint64_t id;  // Unique per timer; doubles as scheduling order
+    };
+
+    struct Counts {
+        std::uint64_t advances{ 0 };
+        std::uint64_t scheduled{ 0 };
+        std::uint64_t fired{ 0 };
+        std::uint64_t walks{ 0 };
+        std::uint64_t longJumps{ 0 };
+        std::uint64_t backSteps{ 0 };
+        std::uint64_t resets{ 0 };
+    };
+
+    // How far ahead (or behind) of 'now' a new timer is due
+    double pickDelay(std::mt19937& rng, double resolution) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        switch (rng() % 8) {
+            case 0: return -unit(rng) * 60.0;                        // Already overdue
+            case 1: return 0.0;
+            case 2: return static_cast<double>(rng() % 200) * resolution;  // Exact slot boundaries
+            case 3: return unit(rng) * 5.0;
+            case 4: return unit(rng) * 600.0;
+            case 5: return unit(rng) * 6.0 * 3600.0;
+            case 6: return unit(rng) * 12.0 * DAY;                   // Top level and overflow
+            default: return unit(rng) * 60.0 * DAY;
+        }
+    }
+
+    double pickClockStep(std::mt19937& rng, double resolution, Counts& counts) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        int roll = static_cast<int>(rng() % 100);
+        if (roll < 70) {
+            return resolution * (0.5 + unit(rng));  // Normal tick with jitter
+        }
+        if (roll < 80) {
+            return unit(rng) * 30.0;  // Stall
+        }
+        if (roll < 86) {
+            return unit(rng) * 4.0 * 3600.0;  // Long stall
+        }
+        if (roll < 90) {
+            ++counts.longJumps;
+            return DAY + unit(rng) * 20.0 * DAY;  // Multi-day jump
+        }
+        if (roll < 96) {
+            ++counts.backSteps;
+            return -unit(rng) * 5.0;  // Clock stepped back
+        }
+        ++counts.backSteps;
+        return -unit(rng) * 2.0 * 3600.0;
+    }
+
+    // Checks one advance() result against the reference and removes the fired
+    // timers from it. Empty string when the wheel kept its contract.
+    std::string checkFired(const std::vector<TimerWheel::Timer>& fired, std::vector<Pending>& pending,
+                           double now, double resolution) {
+        std::ostringstream err;
+        err.precision(17);
+
+        for (std::size_t i = 0; i < fired.size(); ++i) {
+            const auto& timer = fired[i];
+            auto it = std::find_if(pending.begin(), pending.end(), [&timer](const Pending& p) {
+                return p.id == timer.id;
+            });
+            if (it == pending.end()) {
+                err << "timer " << timer.id << " fired but was not pending (fired twice?)";
+                return err.str();
+            }
+            if (timer.dueTime != it->dueTime || timer.kind != static_cast<std::uint32_t>(timer.id % 3)) {
+                err << "timer " << timer.id << " came out with the wrong due time or kind";
+                return err.str();
+            }
+            if (timer.dueTime > now + TIME_EPSILON) {
+                err << "timer " << timer.id << " fired early: due " << timer.dueTime << ", now " << now;
+                return err.str();
+            }
+            if (i > 0) {
+                const auto& prev = fired[i - 1];
+                if (prev.dueTime > timer.dueTime || (prev.dueTime == timer.dueTime && prev.id > timer.id)) {
+                    err << "timers " << prev.id << " and " << timer.id << " out of order";
+                    return err.str();
+                }
+            }
+            pending.erase(it);
+        }
+
+        for (const auto& p : pending) {
+            if (p.dueTime <= now - resolution - TIME_EPSILON) {
+                err << "timer " << p.id << " due " << p.dueTime << " not fired at " << now;
+                return err.str();
+            }
+        }
+        return {};
+    }
+
+    // One randomized sequence on a fresh wheel. The first operation anchors it.
+    std::string runSequence(std::mt19937& rng, double resolution, bool walking, Counts& counts) {
+        TimerWheel wheel(resolution);
+        std::vector<Pending> pending;
+        std::vector<TimerWheel::Timer> fired;
+        std::uint64_t nextId = 1;
+        double now = START_TIME + static_cast<double>(rng() % 1000) * 0.37;
+
+        auto schedule = [&](double dueTime) {
+            wheel.schedule(dueTime, static_cast<std::uint32_t>(nextId % 3), nextId);
+            pending.push_back(Pending{ dueTime, nextId });
+            ++nextId;
+            ++counts.scheduled;
+        };
+
+        // Sometimes the first timer anchors the wheel well away from 'now'
+        if (rng() % 2 == 0) {
+            schedule(now + pickDelay(rng, resolution));
+        }
+
+        const int steps = walking ? WALK_STEPS : STEPS_PER_SEQUENCE;
+        std::uniform_int_distribution<std::uint64_t> walkSlots(WALK_MIN_SLOTS, WALK_MAX_SLOTS);
+        for (int step = 0; step < steps; ++step) {
+            int scheduleCount = static_cast<int>(rng() % 4);
+            for (int i = 0; i < scheduleCount; ++i) {
+                schedule(now + pickDelay(rng, resolution));
+            }
+
+            int roll = walking ? 1000 : static_cast<int>(rng() % 1000);
+            if (roll == 0) {
+                wheel.clear();
+                pending.clear();
+            } else if (roll < 4) {
+                wheel.reset(now);
+                ++counts.resets;
+            }
+
+            now += walking ? static_cast<double>(walkSlots(rng)) * resolution : pickClockStep(rng, resolution, counts);
+            fired.clear();
+            wheel.advance(now, fired);
+            ++counts.advances;
+            counts.fired += fired.size();
+
+            std::string err = checkFired(fired, pending, now, resolution);
+            if (err.empty() && wheel.size() != pending.size()) {
+                err = "size " + std::to_string(wheel.size()) + " != " + std::to_string(pending.size()) + " pending";
+            }
+            if (!err.empty()) {
+                return "step " + std::to_string(step) + ": " + err;
+            }
+        }
+
+        // Far enough ahead for everything left, including overflow
+        now += 100.0 * DAY;
+        fired.clear();
+        wheel.advance(now, fired);
+        counts.fired += fired.size();
+        std::string err = checkFired(fired, pending, now, resolution);
+        if (err.empty() && (!pending.empty() || !wheel.empty())) {
+            err = "timers left after the final advance";
+        }
+        return err.empty() ? err : "final advance: " + err;
+    }
+}
+
+void TestClient::runTimerWheelCheck(int sequenceCount) {
+    req::shared::logInfo("TestClient", "=== TIMER WHEEL CHECK ===");
+    std::cout << "\n=== Timer Wheel Check (" << sequenceCount << " sequences x " << STEPS_PER_SEQUENCE
+              << " advances) ===\n";
+
+    const double resolutions[] = { 0.05, 0.1, 1.0 };
+    std::mt19937 rng(2024);
+    Counts counts;
+    bool ok = true;
+    for (int i = 0; i < sequenceCount && ok; ++i) {
+        double resolution = resolutions[static_cast<std::size_t>(i) % std::size(resolutions)];
+        bool walking = i % 4 == 3;
+        counts.walks += walking ? 1 : 0;
+        std::string err = runSequence(rng, resolution, walking, counts);
+        if (!err.empty()) {
+            std::cout << "Sequence " << i << " (resolution " << resolution << " s" << (walking ? ", walking" : "")
+                      << ") FAILED: " << err << "\n";
+            ok = false;
+        }
+    }
+
+    std::cout << "Randomized: " << counts.advances << " advances, " << counts.scheduled << " timers scheduled, "
+              << counts.fired << " fired, " << counts.walks << " walking sequences, " << counts.longJumps << " multi-day jumps, "
+              << counts.backSteps << " backward steps, " << counts.resets << " resets\n";
+    std::cout << "Verify -> " << (ok ? "PASS" : "FAIL") << "\n";
+
+    req::shared::logInfo("TestClient", std::string{"Timer wheel check complete: "} + (ok ? "PASS" : "FAIL"));
+}
+
+} // namespace req::testclient
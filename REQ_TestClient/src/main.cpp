@@ -80,6 +80,85 @@ int main(int argc, char* argv[]) {
             client.runNegativeTests();
             return 0;
         }
+        else if (arg == "--udp-test" || arg == "-u") {
+            // Optional client-side loss percentage, e.g. --udp-test 20
+            float lossPercent = 0.0f;
+            if (argc >= 3) {
+                int parsed = parseIntArg(argv[2]);
+                if (parsed < 0 || parsed > 100) {
+                    std::cout << "Error: loss percent must be between 0 and 100\n";
+                    return 1;
+                }
+                lossPercent = static_cast<float>(parsed);
+            }
+            client.runUdpChannelTest(lossPercent);
+            return 0;
+        }
+        else if (arg == "--quant-bench" || arg == "-qb") {
+            // Optional entity count, e.g. --quant-bench 1000
+            int entityCount = 200;
+            if (argc >= 3) {
+                entityCount = parseIntArg(argv[2]);
+                if (entityCount <= 0 || entityCount > 65535) {
+                    std::cout << "Error: entity count must be between 1 and 65535\n";
+                    return 1;
+                }
+            }
+            client.runQuantizationBenchmark(entityCount);
+            return 0;
+        }
+        else if (arg == "--motion-bench" || arg == "-mb") {
+            // Optional player count, e.g. --motion-bench 5000
+            int playerCount = 1000;
+            if (argc >= 3) {
+                playerCount = parseIntArg(argv[2]);
+                if (playerCount <= 0 || playerCount > 1000000) {
+                    std::cout << "Error: player count must be between 1 and 1000000\n";
+                    return 1;
+                }
+            }
+            client.runMotionBenchmark(playerCount);
+            return 0;
+        }
+        else if (arg == "--entity-bench" || arg == "-eb") {
+            // Optional NPC count, e.g. --entity-bench 10000
+            int npcCount = 1000;
+            if (argc >= 3) {
+                npcCount = parseIntArg(argv[2]);
+                if (npcCount <= 0 || npcCount > 1000000) {
+                    std::cout << "Error: NPC count must be between 1 and 1000000\n";
+                    return 1;
+                }
+            }
+            client.runEntityStorageBenchmark(npcCount);
+            return 0;
+        }
+        else if (arg == "--hate-check" || arg == "-hc") {
+            // Optional sequence count, e.g. --hate-check 5000
+            int sequenceCount = 500;
+            if (argc >= 3) {
+                sequenceCount = parseIntArg(argv[2]);
+                if (sequenceCount <= 0 || sequenceCount > 1000000) {
+                    std::cout << "Error: sequence count must be between 1 and 1000000\n";
+                    return 1;
+                }
+            }
+            client.runHateListCheck(sequenceCount);
+            return 0;
+        }
+        else if (arg == "--timer-check" || arg == "-tc") {
+            // Optional sequence count, e.g. --timer-check 1000
+            int sequenceCount = 100;
+            if (argc >= 3) {
+                sequenceCount = parseIntArg(argv[2]);
+                if (sequenceCount <= 0 || sequenceCount > 1000000) {
+                    std::cout << "Error: sequence count must be between 1 and 1000000\n";
+                    return 1;
+                }
+            }
+            client.runTimerWheelCheck(sequenceCount);
+            return 0;
+        }
         else if (arg == "--interactive" || arg == "-i") {
             client.run();
             return 0;
@@ -109,6 +188,12 @@ int main(int argc, char* argv[]) {
             std::cout << "  --bad-session, -bs      Test bad session token handling\n";
             std::cout << "  --bad-handoff, -bh      Test bad handoff token handling\n";
             std::cout << "  --negative-tests, -n    Run malformed payload tests\n";
+            std::cout << "  --udp-test [loss%], -u  UDP side-channel test with optional simulated loss (0-100)\n";
+            std::cout << "  --quant-bench [N], -qb  Offline state quantization benchmark with N entities (default 200)\n";
+            std::cout << "  --motion-bench [N], -mb Offline player motion kernel benchmark with N players (default 1000)\n";
+            std::cout << "  --entity-bench [N], -eb Offline entity storage benchmark with N NPCs (default 1000)\n";
+            std::cout << "  --hate-check [N], -hc   Offline HateList check over N random sequences (default 500)\n";
+            std::cout << "  --timer-check [N], -tc  Offline TimerWheel check over N random sequences (default 100)\n";
             std::cout << "  --interactive, -i       Original interactive mode\n";
             std::cout << "  --bot-count <N>, -bc <N>  Spawn N bots for load testing (1-100)\n";
             std::cout << "  --help                  Show this help\n\n";
@@ -4,6 +4,7 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 #include <boost/asio.hpp>
@@ -13,6 +14,7 @@
 #include "../../REQ_Shared/include/req/shared/MessageTypes.h"
 #include "../../REQ_Shared/include/req/shared/MessageHeader.h"
 #include "../../REQ_Shared/include/req/shared/Connection.h"
+#include "../../REQ_Shared/include/req/shared/NetMetrics.h"
 #include "../../REQ_Shared/include/req/shared/Config.h"
 #include "../../REQ_Shared/include/req/shared/CharacterStore.h"
 #include "../../REQ_Shared/include/req/shared/AccountStore.h"
@@ -38,7 +40,7 @@ private:
     void handleNewConnection(Tcp::socket socket);
 
     void handleMessage(const req::shared::MessageHeader& header,
-                       const req::shared::net::Connection::ByteArray& payload,
+                       std::string_view payload,
                        ConnectionPtr connection);
 
     req::shared::HandoffToken generateHandoffToken();
@@ -55,12 +57,14 @@ private:
     void cmdListAccounts();
     void cmdListChars(std::uint64_t accountId);
     void cmdShowChar(std::uint64_t characterId);
+    void cmdNetStats();
     void cmdHelp();
 
     boost::asio::io_context ioContext_{};
     Tcp::acceptor           acceptor_;
 
     std::vector<ConnectionPtr> connections_;
+    std::shared_ptr<req::shared::net::NetMetrics> netMetrics_{ std::make_shared<req::shared::net::NetMetrics>() };
     std::unordered_map<req::shared::HandoffToken, std::uint64_t> handoffTokenToCharacterId_;
 
     req::shared::WorldConfig config_{};
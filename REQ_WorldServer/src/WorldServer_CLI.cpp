@@ -2,6 +2,8 @@
 
 #include "../../REQ_Shared/include/req/shared/Logger.h"
 
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -66,6 +68,8 @@ void WorldServer::handleCLICommand(const std::string& command) {
             return;
         }
         cmdShowChar(characterId);
+    } else if (cmd == "net_stats") {
+        cmdNetStats();
     } else {
         req::shared::logWarn("world", std::string{"Unknown command: '"} + cmd + "' (type 'help' for commands)");
     }
@@ -77,6 +81,7 @@ void WorldServer::cmdHelp() {
     std::cout << "  list_accounts            List all accounts\n";
     std::cout << "  list_chars <accountId>   List all characters for an account\n";
     std::cout << "  show_char <characterId>  Show detailed character information\n";
+    std::cout << "  net_stats                Show network counters per message type and per connection\n";
     std::cout << "  quit, exit, q            Shutdown the server\n";
     std::cout << "===============================\n";
 }
@@ -173,4 +178,38 @@ void WorldServer::cmdShowChar(std::uint64_t characterId) {
     std::cout << "=========================\n";
 }
 
+void WorldServer::cmdNetStats() {
+    std::cout << "\n" << netMetrics_->formatReport("WorldServer");
+    
+    // connections_ belongs to the IO thread; collect the per-connection lines there
+    auto linesPromise = std::make_shared<std::promise<std::string>>();
+    auto linesFuture = linesPromise->get_future();
+    boost::asio::post(ioContext_, [this, linesPromise]() {
+        std::ostringstream oss;
+        std::size_t open = 0;
+        for (const auto& connection : connections_) {
+            if (!connection || connection->isClosed()) {
+                continue;
+            }
+            ++open;
+            auto stats = connection->getStats();
+            oss << "  " << connection->remoteAddress()
+                << " sent=" << stats.messagesSent << "/" << stats.bytesSent << "B"
+                << " recv=" << stats.messagesReceived << "/" << stats.bytesReceived << "B"
+                << " queue=" << stats.queueDepth << " (high " << stats.queueDepthHighWater << ")"
+                << " pending=" << stats.bytesPending << "B"
+                << " writeLatency p50<=" << stats.writeLatencyP50.count() << "us"
+                << " p99<=" << stats.writeLatencyP99.count() << "us"
+                << " max=" << stats.writeLatencyMax.count() << "us\n";
+        }
+        linesPromise->set_value("Open connections: " + std::to_string(open) + "\n" + oss.str());
+    });
+    
+    if (linesFuture.wait_for(std::chrono::seconds(2)) != std::future_status::ready) {
+        req::shared::logWarn("world", "net_stats: IO thread did not respond; per-connection stats skipped");
+        return;
+    }
+    std::cout << linesFuture.get();
+}
+
 } // namespace req::world
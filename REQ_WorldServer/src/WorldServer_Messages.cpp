@@ -54,7 +54,7 @@ std::optional<std::uint64_t> WorldServer::resolveSessionToken(req::shared::Sessi
 }
 
 void WorldServer::handleMessage(const req::shared::MessageHeader& header,
-                                const req::shared::net::Connection::ByteArray& payload,
+                                std::string_view payload,
                                 ConnectionPtr connection) {
     // Log protocol version
     req::shared::logInfo("world", std::string{"Received message: type="} + 
@@ -68,7 +68,7 @@ void WorldServer::handleMessage(const req::shared::MessageHeader& header,
             std::to_string(header.protocolVersion) + ", server=" + std::to_string(req::shared::CurrentProtocolVersion));
     }
 
-    std::string body(payload.begin(), payload.end());
+    std::string_view body = payload;
 
     switch (header.type) {
     case req::shared::MessageType::WorldAuthRequest: {
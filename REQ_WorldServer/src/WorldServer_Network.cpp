@@ -24,9 +24,10 @@ void WorldServer::startAccept() {
 void WorldServer::handleNewConnection(Tcp::socket socket) {
     auto connection = std::make_shared<req::shared::net::Connection>(std::move(socket));
     connections_.push_back(connection);
+    connection->setMetrics(netMetrics_);
 
     connection->setMessageHandler([this](const req::shared::MessageHeader& header,
-                                         const req::shared::net::Connection::ByteArray& payload,
+                                         std::string_view payload,
                                          std::shared_ptr<req::shared::net::Connection> conn) {
         handleMessage(header, payload, conn);
     });
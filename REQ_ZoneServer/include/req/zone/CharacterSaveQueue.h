@@ -0,0 +1,108 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+#include "../../REQ_Shared/include/req/shared/CharacterStore.h"
+#include "../../REQ_Shared/include/req/shared/DataModels.h"
+#include "../../REQ_Shared/include/req/shared/MpscQueue.h"
+
+namespace req::zone {
+
+/**
+ * CharacterSaveQueue
+ *
+ * Write-behind persistence for ZoneServer. The simulation submits complete
+ * Character snapshots and carries on; one worker thread writes them with
+ * CharacterStore::saveCharacter. A snapshot submitted while an older one for
+ * the same character is still waiting replaces it (only the newest state is
+ * written), so saving a character every tick costs at most one write per
+ * worker pass.
+ *
+ * Reads must go through latest() before the store: a character with a
+ * snapshot waiting, being written, or whose last write failed is served from
+ * memory. One queue serves every zone of the process (ZoneHost shares it), so
+ * a character moving between zones of one process is always read with its
+ * newest state. Readers in other processes (WorldServer, a zone in another
+ * process) only see the file: CharacterStore replaces it atomically, so they
+ * never read a partial file, but until the write completes they read the
+ * previous save (last zone, position, XP).
+ *
+ * A failed write is pushed to the FailureQueue given with the snapshot (the
+ * submitting zone's) and the snapshot is kept; the next submit() for that
+ * character replaces it, and retryFailed() queues the ones nobody replaced.
+ * Writes happen in submission order of each character's first pending
+ * snapshot.
+ *
+ * All members are thread-safe. The destructor writes everything still
+ * pending before joining the worker.
+ */
+class CharacterSaveQueue {
+public:
+    struct Failure {
+        std::uint64_t characterId{ 0 };
+    };
+    // Each submitter drains its own; shared so a failure reported after the
+    // submitter is gone has somewhere to go
+    using FailureQueue = req::shared::MpscQueue<Failure>;
+    using FailureQueuePtr = std::shared_ptr<FailureQueue>;
+
+    struct Stats {
+        std::uint64_t submitted{ 0 };
+        std::uint64_t coalesced{ 0 };   // Submits that replaced a waiting snapshot
+        std::uint64_t written{ 0 };
+        std::uint64_t failed{ 0 };      // Write attempts that failed
+        std::size_t pending{ 0 };       // Waiting or being written now
+        std::size_t maxPending{ 0 };
+        std::size_t failedHeld{ 0 };    // Failed snapshots not yet replaced or retried
+    };
+
+    explicit CharacterSaveQueue(const req::shared::CharacterStore& store);
+    ~CharacterSaveQueue();
+
+    CharacterSaveQueue(const CharacterSaveQueue&) = delete;
+    CharacterSaveQueue& operator=(const CharacterSaveQueue&) = delete;
+
+    void submit(req::shared::data::Character snapshot, FailureQueuePtr failures = nullptr);
+
+    // Newest unwritten state of the character, if any (see class comment)
+    std::optional<req::shared::data::Character> latest(std::uint64_t characterId) const;
+
+    // Queues held failed snapshots again; returns how many
+    std::size_t retryFailed();
+
+    // Blocks until every snapshot submitted so far has been written or has failed
+    void flush();
+
+    Stats stats() const;
+
+private:
+    struct Entry {
+        req::shared::data::Character snapshot;
+        FailureQueuePtr failures;
+    };
+
+    void workerLoop();
+
+    const req::shared::CharacterStore& store_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable idle_;
+    std::unordered_map<std::uint64_t, Entry> waiting_;
+    std::deque<std::uint64_t> order_;  // Characters in waiting_, oldest first
+    std::unordered_map<std::uint64_t, Entry> writing_;  // Only the worker's current one
+    std::unordered_map<std::uint64_t, Entry> failed_;
+    Stats stats_;
+    bool stopping_{ false };
+
+    std::thread worker_;
+};
+
+} // namespace req::zone
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace req::zone {
+
+/**
+ * SpatialGrid
+ *
+ * Uniform hash grid over the XY plane for radius queries ("who is near this
+ * point"). Cells are cellSize x cellSize and only exist while they hold
+ * something, so unbounded zones cost memory per occupied cell only.
+ *
+ * Entities are keyed by id and carry their last known position. update() is
+ * O(1): an entity that stays in its cell only has its position refreshed, one
+ * that crosses a cell border is swap-removed from the old cell and appended
+ * to the new one. With cellSize equal to the usual query radius a query
+ * touches at most 3x3 cells.
+ *
+ * Not thread-safe; ZoneServer only uses it on the simulation strand.
+ */
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 100.0f);
+
+    // Drop everything and switch to a new cell size (<= 0 falls back to the default)
+    void reset(float cellSize);
+    void clear();
+
+    // Insert, or move an existing entity. Returns true if it changed cell (or was new).
+    bool update(std::uint64_t id, float x, float y);
+    void remove(std::uint64_t id);
+
+    bool contains(std::uint64_t id) const { return entities_.find(id) != entities_.end(); }
+    std::size_t size() const { return entities_.size(); }
+    std::size_t cellCount() const { return cells_.size(); }
+    float cellSize() const { return cellSize_; }
+
+    // Calls fn(id, x, y) for every entity within radius of (x, y), itself
+    // included if it is in the grid. Order is unspecified. If fn returns
+    // bool, returning false stops the query early.
+    template<typename Fn>
+    void forEachInRadius(float x, float y, float radius, Fn&& fn) const;
+
+    // Appends the ids forEachInRadius would visit
+    void queryRadius(float x, float y, float radius, std::vector<std::uint64_t>& outIds) const;
+
+private:
+    struct Item {
+        std::uint64_t id;
+        float x;
+        float y;
+    };
+
+    struct Location {
+        std::uint64_t cellKey;
+        std::size_t index;  // Position in cells_[cellKey]
+    };
+
+    std::int32_t cellCoord(float v) const {
+        return static_cast<std::int32_t>(std::floor(v * inverseCellSize_));
+    }
+
+    static std::uint64_t cellKey(std::int32_t cx, std::int32_t cy) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) |
+            static_cast<std::uint32_t>(cy);
+    }
+
+    void removeFromCell(std::uint64_t key, std::size_t index);
+
+    float cellSize_;
+    float inverseCellSize_;
+    std::unordered_map<std::uint64_t, std::vector<Item>> cells_;
+    std::unordered_map<std::uint64_t, Location> entities_;
+};
+
+template<typename Fn>
+void SpatialGrid::forEachInRadius(float x, float y, float radius, Fn&& fn) const {
+    if (entities_.empty() || radius < 0.0f) {
+        return;
+    }
+
+    const float radiusSq = radius * radius;
+    // Returns false once fn asked to stop
+    auto visitCell = [&](const std::vector<Item>& items) {
+        for (const Item& item : items) {
+            float dx = item.x - x;
+            float dy = item.y - y;
+            if (dx * dx + dy * dy > radiusSq) {
+                continue;
+            }
+            if constexpr (std::is_same_v<std::invoke_result_t<Fn&, std::uint64_t, float, float>, bool>) {
+                if (!fn(item.id, item.x, item.y)) {
+                    return false;
+                }
+            } else {
+                fn(item.id, item.x, item.y);
+            }
+        }
+        return true;
+    };
+
+    const std::int32_t minX = cellCoord(x - radius);
+    const std::int32_t maxX = cellCoord(x + radius);
+    const std::int32_t minY = cellCoord(y - radius);
+    const std::int32_t maxY = cellCoord(y + radius);
+
+    // A radius far larger than the cells would visit mostly empty cells; walk
+    // the occupied ones instead
+    const auto spanCells = (static_cast<std::uint64_t>(maxX - minX) + 1) * (static_cast<std::uint64_t>(maxY - minY) + 1);
+    if (spanCells > cells_.size()) {
+        for (const auto& [key, items] : cells_) {
+            if (!visitCell(items)) {
+                return;
+            }
+        }
+        return;
+    }
+
+    for (std::int32_t cx = minX; cx <= maxX; ++cx) {
+        for (std::int32_t cy = minY; cy <= maxY; ++cy) {
+            auto it = cells_.find(cellKey(cx, cy));
+            if (it != cells_.end() && !visitCell(it->second)) {
+                return;
+            }
+        }
+    }
+}
+
+} // namespace req::zone
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace req::zone {
+
+/**
+ * TimerWheel
+ *
+ * Hierarchical timing wheel for zone deadlines (spawns, respawns, corpse
+ * expiry, periodic checks). Each timer carries an absolute due time in
+ * seconds on the caller's clock; the zone uses seconds since the Unix epoch,
+ * the same clock as SpawnRecord::next_spawn_time and Corpse::expiresAtUnix.
+ *
+ * Time is cut into slots of 'resolution' seconds. Level 0 has 64 slots of
+ * one slot each, each higher level 64 slots of 64x the level below; timers
+ * further out than the top level wait in an overflow list. A timer moves
+ * down a level when the wheel reaches its slot on the level above, so
+ * advance() only touches the slots it passes and the timers in them:
+ * timers that are not due cost nothing per tick.
+ *
+ * Because due times are absolute, a stall (or a clock jump) just makes the
+ * next advance() return everything that came due in between. A jump of more
+ * than one level-1 revolution re-files the pending timers instead of stepping
+ * through every slot. Timers restored from saved state are scheduled with
+ * their saved due time. A clock that goes backwards fires nothing until it
+ * catches up.
+ *
+ * There is no cancel: callers reschedule by scheduling again and treat a
+ * fired timer as a hint, checking their own state (e.g. the record's current
+ * due time) before acting on it.
+ *
+ * Not thread-safe; ZoneServer only uses it on the simulation strand.
+ */
+class TimerWheel {
+public:
+    struct Timer {
+        double dueTime{ 0.0 };
+        std::uint32_t kind{ 0 };  // Caller-defined (ZoneTimerKind in the zone)
+        std::uint64_t id{ 0 };    // Caller-defined target of the timer
+    };
+
+    explicit TimerWheel(double resolution = 0.05);
+
+    // Anchors slot 0 at 'now'. Pending timers are kept and re-filed. Without
+    // a call, the first schedule() or advance() anchors the wheel.
+    void reset(double now);
+    void clear();
+
+    void schedule(double dueTime, std::uint32_t kind, std::uint64_t id);
+
+    // Appends timers that are due to 'due', ordered by due time (equal due
+    // times in the order they were scheduled). A timer never comes out
+    // before its due time and at most one resolution after it.
+    void advance(double now, std::vector<Timer>& due);
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    double resolution() const { return resolution_; }
+
+private:
+    static constexpr int SlotBits = 6;
+    static constexpr std::size_t SlotCount = std::size_t{ 1 } << SlotBits;
+    static constexpr int LevelCount = 4;
+
+    struct Entry {
+        Timer timer;
+        std::uint64_t sequence;  // Scheduling order, for stable firing order
+    };
+
+    std::uint64_t slotFor(double time) const;
+    void anchor(double now);
+    void file(Entry entry);
+    void refileAll(std::uint64_t newSlot);
+    void cascade(int level, std::size_t index);
+    void collect(std::vector<Entry>& from, double now, std::vector<Entry>& out);
+
+    double resolution_;
+    double origin_{ 0.0 };
+    bool anchored_{ false };
+    std::uint64_t currentSlot_{ 0 };  // Last slot advance() has processed
+    std::uint64_t nextSequence_{ 0 };
+    std::size_t size_{ 0 };
+
+    std::array<std::array<std::vector<Entry>, SlotCount>, LevelCount> levels_;
+    std::vector<Entry> overflow_;  // Beyond the top level
+    std::vector<Entry> ready_;     // Due by slot when scheduled; fired on the next advance
+    std::vector<Entry> firing_;    // Scratch for advance()
+};
+
+} // namespace req::zone
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <boost/asio.hpp>
+
+#include "../../REQ_Shared/include/req/shared/MessageHeader.h"
+#include "../../REQ_Shared/include/req/shared/Connection.h"
+#include "../../REQ_Shared/include/req/shared/ProtocolSchemas.h"
+
+namespace req::zone {
+
+/**
+ * ZoneDatagramChannel
+ *
+ * Unreliable UDP side-channel for one zone (ZoneCapability::UdpChannel).
+ * Wire format and session handshake are documented in Protocol_Zone.h
+ * ("UDP Side-Channel").
+ *
+ * A session is registered after ZoneAuth with the character id and the
+ * handoff token as its key; the client's endpoint is learned from its first
+ * valid Hello. sendFrame() returns false whenever the session cannot take the
+ * frame (not bound, timed out, too large) so the caller sends it over TCP.
+ *
+ * Threading: the socket is bound to the executor passed in (the zone's
+ * simulation strand), so receive handlers run there and every other method
+ * must be called from it as well.
+ */
+class ZoneDatagramChannel {
+public:
+    using Udp = boost::asio::ip::udp;
+    using MessageHandler = std::function<void(std::uint64_t characterId,
+                                              const req::shared::MessageHeader& header,
+                                              std::string_view payload)>;
+
+    struct Stats {
+        std::uint64_t datagramsSent{ 0 };
+        std::uint64_t datagramsReceived{ 0 };    // Accepted (valid key, in order)
+        std::uint64_t datagramsRejected{ 0 };    // Bad magic/key/endpoint, unknown session
+        std::uint64_t datagramsStale{ 0 };       // Sequence not newer than the last accepted
+        std::uint64_t simulatedLossDrops{ 0 };   // Dropped by udpSimulatedLossPercent (both directions)
+    };
+
+    ZoneDatagramChannel(const boost::asio::any_io_executor& executor,
+                        float sessionTimeoutSec,
+                        float simulatedLossPercent);
+
+    // Bind the socket; logs and returns false on failure
+    bool open(const std::string& address, std::uint16_t port);
+    void start();
+    void close();
+
+    std::uint16_t localPort() const { return localPort_; }
+
+    void setMessageHandler(MessageHandler handler) { onMessage_ = std::move(handler); }
+
+    void addSession(std::uint64_t characterId, std::uint64_t sessionKey);
+    void removeSession(std::uint64_t characterId);
+
+    // Bound and heard from within the session timeout
+    bool isActive(std::uint64_t characterId);
+
+    // Send a prebuilt frame (MessageHeader + payload) unreliably. Returns false
+    // if the caller must fall back to TCP.
+    bool sendFrame(std::uint64_t characterId, const req::shared::net::Connection::SharedFrame& frame);
+
+    const Stats& getStats() const { return stats_; }
+
+private:
+    struct Session {
+        std::uint64_t sessionKey{ 0 };
+        Udp::endpoint endpoint;
+        bool bound{ false };
+        std::chrono::steady_clock::time_point lastReceive{};
+        std::uint32_t sendSequence{ 0 };
+        std::uint32_t lastReceiveSequence{ 0 };
+        bool hasReceivedMessage{ false };
+    };
+
+    void doReceive();
+    void handleDatagram(std::string_view datagram, const Udp::endpoint& sender);
+    void sendDatagram(const Udp::endpoint& endpoint, std::string datagram);
+    bool dropForSimulatedLoss();
+
+    Udp::socket socket_;
+    Udp::endpoint senderEndpoint_;
+    std::array<char, 2048> receiveBuffer_{};  // Larger than MaxDatagramBytes so oversize datagrams are detectable
+    std::uint16_t localPort_{ 0 };
+
+    std::chrono::steady_clock::duration sessionTimeout_;
+    float simulatedLossPercent_{ 0.0f };
+    std::mt19937 lossRng_{ std::random_device{}() };
+
+    std::unordered_map<std::uint64_t, Session> sessions_;  // characterId -> session
+    MessageHandler onMessage_;
+    Stats stats_{};
+};
+
+} // namespace req::zone
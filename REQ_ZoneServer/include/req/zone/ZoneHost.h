@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "../../REQ_Shared/include/req/shared/CharacterStore.h"
+#include "../../REQ_Shared/include/req/shared/Config.h"
+#include "CharacterSaveQueue.h"
+#include "ZoneServer.h"
+
+namespace req::zone {
+
+/**
+ * ZoneHost
+ *
+ * Runs several ZoneServers in one process on one shared io_context and
+ * thread pool. Each zone keeps its own simulation strand, listening port,
+ * timers and state, so zones never block each other beyond sharing cores; a
+ * quiet zone costs a few idle timers instead of a process of its own.
+ *
+ * Connection I/O runs on per-socket strands (as with zone ioThreads) and
+ * reaches the zone through its inbound queue, so a zone's state is still
+ * only touched from its simulation strand.
+ *
+ * All zones save characters through one CharacterSaveQueue, so a character
+ * entering a zone sees what its previous zone in this process queued.
+ *
+ * NPC AI evaluation likewise uses one host-wide pool (aiThreadCount workers)
+ * instead of one per zone; a zone's npc_ai_threads setting is ignored here.
+ */
+class ZoneHost {
+public:
+    struct ZoneSpec {
+        std::uint32_t zoneId{ 0 };
+        std::string zoneName;
+        std::uint16_t port{ 0 };
+    };
+
+    // threadCount 0 = one thread per hardware core; aiThreadCount 0 = NPC AI
+    // runs on each zone's simulation strand
+    ZoneHost(std::uint32_t worldId,
+             std::string address,
+             req::shared::WorldRules worldRules,
+             req::shared::XpTable xpTable,
+             std::string charactersPath,
+             std::uint32_t threadCount,
+             std::uint32_t aiThreadCount = 0);
+
+    // Throws std::runtime_error on a duplicate zone id or port
+    void addZone(const ZoneSpec& spec);
+
+    // Starts every zone and runs the pool; returns after stop()
+    void run();
+    void stop();
+
+    std::size_t zoneCount() const { return zones_.size(); }
+
+private:
+    boost::asio::io_context ioContext_;
+    std::uint32_t worldId_;
+    std::string address_;
+    req::shared::WorldRules worldRules_;
+    req::shared::XpTable xpTable_;
+    std::string charactersPath_;
+    std::uint32_t threadCount_;
+    std::uint32_t aiThreadCount_;
+
+    // Declared before zones_: outlive every zone that uses them
+    req::shared::CharacterStore characterStore_;
+    CharacterSaveQueue characterSaves_;
+    std::unique_ptr<boost::asio::thread_pool> npcAiPool_;  // Null when aiThreadCount_ == 0
+
+    std::vector<ZoneSpec> specs_;
+    std::vector<std::unique_ptr<ZoneServer>> zones_;
+    std::vector<std::thread> threads_;
+};
+
+} // namespace req::zone
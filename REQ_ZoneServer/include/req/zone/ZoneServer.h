@@ -3,9 +3,15 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <chrono>
+#include <deque>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <thread>
+#include <random>
 
 #include <boost/asio.hpp>
 
@@ -14,23 +20,100 @@
 #include "../../REQ_Shared/include/req/shared/MessageTypes.h"
 #include "../../REQ_Shared/include/req/shared/MessageHeader.h"
 #include "../../REQ_Shared/include/req/shared/Connection.h"
+#include "../../REQ_Shared/include/req/shared/NetMetrics.h"
 #include "../../REQ_Shared/include/req/shared/Config.h"
 #include "../../REQ_Shared/include/req/shared/CharacterStore.h"
 #include "../../REQ_Shared/include/req/shared/AccountStore.h"
 #include "../../REQ_Shared/include/req/shared/ProtocolSchemas.h"
+#include "../../REQ_Shared/include/req/shared/MpscQueue.h"
+#include "../../REQ_Shared/include/req/shared/MotionKernel.h"
+#include "../../REQ_Shared/include/req/shared/SlotMap.h"
 #include "NpcSpawnData.h"
+#include "ZoneDatagramChannel.h"
+#include "SpatialGrid.h"
+#include "TimerWheel.h"
+#include "CharacterSaveQueue.h"
 
 namespace req::zone {
 
+/**
+ * PlayerLatency
+ * 
+ * Round-trip time and clock offset for one player, measured with Ping/Pong
+ * (ZoneServer_Latency.cpp). RTT is smoothed the way TCP smooths SRTT
+ * (RFC 6298: gain 1/8, variance gain 1/4). The client clock maps to the
+ * server clock as serverTimeMs ~= clientTimeMs + clockOffsetMs.
+ */
+struct PlayerLatency {
+    std::uint32_t lastPingId{ 0 };
+    std::uint64_t lastPingSentMs{ 0 };    // Server clock (ZoneServer::serverTimeMs)
+    std::uint32_t samples{ 0 };           // Pongs received; 0 = no estimate yet
+    float lastRttMs{ 0.0f };
+    float smoothedRttMs{ 0.0f };
+    float rttVarianceMs{ 0.0f };
+    std::int64_t clockOffsetMs{ 0 };      // Server clock minus client clock
+    std::int64_t lastInputDelayMs{ 0 };   // Last MovementIntent: server receive time minus client send time
+    
+    bool hasEstimate() const { return samples > 0; }
+};
+
+/**
+ * SnapshotBaselines
+ * 
+ * Per-player state for ZoneCapability::DeltaSnapshots: the snapshots sent
+ * recently (entries sorted by characterId), so the next one can be encoded
+ * against whichever of them the client acknowledged last.
+ */
+struct SnapshotBaselines {
+    std::uint64_t ackedSnapshotId{ 0 };   // From MovementIntent; only moves forward
+    std::deque<std::pair<std::uint64_t, std::vector<req::shared::protocol::PlayerStateEntry>>> sent;  // Oldest first
+    std::uint64_t deltasSent{ 0 };
+    std::uint64_t fullStatesSent{ 0 };    // No usable baseline (first snapshot, ack missing or too old)
+};
+
+/**
+ * TickStats
+ * 
+ * Timing of the simulation tick loop. Ticks run on absolute deadlines
+ * (one per 1/tickRateHz); a wake-up that finds several deadlines passed runs
+ * the missed steps back to back, up to maxCatchUpTicks, and skips the rest.
+ * Counters are totals since start; the sample vectors cover the current
+ * tick_stats_interval_sec window and are cleared after each report.
+ */
+struct TickStats {
+    std::uint64_t wakeUps{ 0 };           // onTick calls
+    std::uint64_t steps{ 0 };             // updateSimulation calls
+    std::uint64_t lateWakeUps{ 0 };       // Woke a full period or more past the deadline
+    std::uint64_t catchUpSteps{ 0 };      // Extra steps run by late wake-ups
+    std::uint64_t skippedSteps{ 0 };      // Steps dropped because the backlog exceeded maxCatchUpTicks
+    std::uint64_t overruns{ 0 };          // Tick work took longer than one period
+    std::vector<std::uint32_t> windowDurationsUs;     // Wake-up to end of tick work
+    std::vector<std::uint32_t> windowWakeLatenciesUs; // Deadline to wake-up
+};
+
 /**
  * ZonePlayer
  * 
  * In-memory state for a player currently active in this zone.
  * Tracks position, velocity, last input, validation data, and combat state.
+ * 
+ * 'character' is the full persistent record, loaded once at ZoneAuth and
+ * authoritative while the player is in the zone: gameplay changes it in
+ * memory and marks the player dirty, and the save path
+ * (ZoneServer::savePlayerPosition) is the only thing that writes it out.
+ * Position, hp/mana and stats live in the fields below during play and are
+ * copied into it by ZoneServer::refreshCharacterRecord; level and xp are
+ * kept equal in both.
+ * 
+ * The movement step runs on ZoneServer::playerMotion_ (SoA), which owns
+ * pos/vel/lastValidPos/input while the tick runs and copies them back here
+ * when they change. Code that writes any of those fields (or isDead /
+ * isInitialized) outside the step must call ZoneServer::syncPlayerMotion.
  */
 struct ZonePlayer {
     std::uint64_t accountId{ 0 };          // Account owner
     std::uint64_t characterId{ 0 };
+    req::shared::data::Character character;  // Persistent record (see above)
     
     // Admin flag (cached from Account on zone entry)
     bool isAdmin{ false };
@@ -38,6 +121,9 @@ struct ZonePlayer {
     // Connection for sending messages
     std::shared_ptr<req::shared::net::Connection> connection;
     
+    // Negotiated ZoneCapability bits (from ZoneAuthRequest)
+    std::uint32_t capabilities{ req::shared::protocol::ZoneCapability::None };
+    
     // Current state
     float posX{ 0.0f };
     float posY{ 0.0f };
@@ -57,6 +143,7 @@ struct ZonePlayer {
     float inputY{ 0.0f };
     bool isJumpPressed{ false };
     std::uint32_t lastSequenceNumber{ 0 };
+    std::uint32_t motionSlot{ req::shared::MotionTable::NoSlot };  // Row in ZoneServer::playerMotion_
     
     // Combat state (loaded from character, persisted on zone exit)
     std::int32_t level{ 1 };
@@ -85,6 +172,12 @@ struct ZonePlayer {
     
     // Entity tracking - which entities this player knows about
     std::unordered_set<std::uint64_t> knownEntities;  // Set of entity IDs player has received spawn messages for
+    
+    // Network latency (Ping/Pong)
+    PlayerLatency latency;
+    
+    // Delta snapshot baselines (only used with ZoneCapability::DeltaSnapshots)
+    SnapshotBaselines snapshotBaselines;
 };
 
 // Use shared ZoneConfig from Config.h (no duplicate definition needed)
@@ -127,6 +220,17 @@ struct SpawnRecord {
     std::uint64_t current_entity_id{ 0 };    // NPC instance ID when Alive, 0 when WaitingToSpawn
 };
 
+/**
+ * ZoneTimerKind
+ * 
+ * What a zone TimerWheel timer is for; the timer's id names its target.
+ */
+enum class ZoneTimerKind : std::uint32_t {
+    SpawnDue,        // id = spawn_point_id, due at SpawnRecord::next_spawn_time
+    CorpseExpiry,    // id = corpseId, due at Corpse::expiresAtUnix
+    SpawnIntegrity   // Periodic spawn record check (id unused)
+};
+
 class ZoneServer {
 public:
     ZoneServer(std::uint32_t worldId,
@@ -137,10 +241,34 @@ public:
                const req::shared::WorldRules& worldRules,
                const req::shared::XpTable& xpTable,
                const std::string& charactersPath = "data/characters");
+    
+    // Hosted zone (ZoneHost): runs on a shared io_context whose threads the
+    // host owns; the zone only gets its own strand, listener and timers.
+    // Character saves go to the host's queue, shared by all its zones, and
+    // NPC AI runs on the host's pool of npcAiThreads workers (null = none).
+    ZoneServer(boost::asio::io_context& sharedIoContext,
+               CharacterSaveQueue& sharedCharacterSaves,
+               boost::asio::thread_pool* sharedNpcAiPool,
+               std::uint32_t npcAiThreads,
+               std::uint32_t worldId,
+               std::uint32_t zoneId,
+               const std::string& zoneName,
+               const std::string& address,
+               std::uint16_t port,
+               const req::shared::WorldRules& worldRules,
+               const req::shared::XpTable& xpTable,
+               const std::string& charactersPath = "data/characters");
 
+    // Standalone: start(), then run the zone's own io_context until stop()
     void run();
+    // Load zone data and start accepting, ticking and autosaving; the work
+    // runs on whichever threads run the io_context
+    void start();
     void stop();
     
+    std::uint32_t zoneId() const { return zoneId_; }
+    const std::string& zoneName() const { return zoneName_; }
+    
     // Set zone configuration (safe spawn point, interest management, etc.)
     void setZoneConfig(const ZoneConfig& config);
 
@@ -148,12 +276,45 @@ private:
     using Tcp = boost::asio::ip::tcp;
     using ConnectionPtr = std::shared_ptr<req::shared::net::Connection>;
 
+    ZoneServer(std::unique_ptr<boost::asio::io_context> ownedIoContext,
+               boost::asio::io_context* sharedIoContext,
+               CharacterSaveQueue* sharedCharacterSaves,
+               boost::asio::thread_pool* sharedNpcAiPool,
+               std::uint32_t sharedNpcAiThreads,
+               std::uint32_t worldId,
+               std::uint32_t zoneId,
+               const std::string& zoneName,
+               const std::string& address,
+               std::uint16_t port,
+               const req::shared::WorldRules& worldRules,
+               const req::shared::XpTable& xpTable,
+               const std::string& charactersPath);
+    
+    // True when connection callbacks can run on threads other than the
+    // simulation strand's (I/O threads, or a shared host pool)
+    bool concurrentIo() const { return ioThreadCount_ > 0 || !ownedIoContext_; }
+
     void startAccept();
     void handleNewConnection(Tcp::socket socket);
+    
+    // Inbound handoff from I/O threads to the simulation strand (ioThreads > 0).
+    // Messages and disconnects share one queue so they are applied in order.
+    struct InboundEvent {
+        enum class Kind : std::uint8_t { Message, Disconnect };
+        Kind kind{ Kind::Message };
+        req::shared::MessageHeader header{};
+        std::string payload;  // Owned copy; the connection's read buffer is reused
+        ConnectionPtr connection;
+        std::uint64_t receivedAtMs{ 0 };  // serverTimeMs() when the I/O thread read it
+    };
+    void drainInboundEvents();
 
+    // receivedAtMs: serverTimeMs() at arrival if the message was queued
+    // (0 = it is being handled as it arrives)
     void handleMessage(const req::shared::MessageHeader& header,
-                       const req::shared::net::Connection::ByteArray& payload,
-                       ConnectionPtr connection);
+                       std::string_view payload,
+                       ConnectionPtr connection,
+                       std::uint64_t receivedAtMs = 0);
     
     // Zone entry spawn logic
     void spawnPlayer(req::shared::data::Character& character, ZonePlayer& player);
@@ -162,22 +323,82 @@ private:
     void savePlayerPosition(std::uint64_t characterId);
     void saveAllPlayerPositions();
     
+    // Character persistence goes through characterSaves_: loads see saves
+    // that are still queued, saves never block the tick. Only ZoneAuth loads;
+    // players in the zone use ZonePlayer::character.
+    std::optional<req::shared::data::Character> loadCharacter(std::uint64_t characterId) const;
+    void refreshCharacterRecord(ZonePlayer& player);  // Live fields -> player.character
+    void drainCharacterSaveFailures();
+    
     // NPC management
     void loadNpcsForZone();
-    void updateNpc(req::shared::data::ZoneNpc& npc, float deltaSeconds);
-    void updateNpcAi(req::shared::data::ZoneNpc& npc, float deltaSeconds);
+    void updateNpc(req::shared::data::ZoneNpc& npc, float deltaSeconds);  // Dead NPCs: respawn countdown
+    
+    // NPC AI phase. Living NPCs due this tick are evaluated (possibly in
+    // parallel) against a read-only view of the zone; each evaluation writes
+    // the NPC's own fields to its job and its effects on anything else as
+    // commands. The apply phase then runs on the simulation thread: every
+    // job's own fields first, then every job's commands, both in NPC order,
+    // so the outcome does not depend on the number of AI threads.
+    struct NpcAiCommand {
+        enum class Kind : std::uint8_t {
+            AddHate,      // npcId gains 'amount' hate on entityId
+            ClearHate,    // npcId's hate table is emptied
+            AssistAlert,  // npcId goes Idle->Alert with 'amount' hate on entityId, if still Idle
+            MeleeAttack,  // npcId hits player entityId for a roll in [minDamage, maxDamage]
+            Log           // Info log line
+        };
+        Kind kind{ Kind::Log };
+        std::uint64_t npcId{ 0 };
+        std::uint64_t entityId{ 0 };
+        std::uint64_t sourceNpcId{ 0 };  // AssistAlert: the NPC being assisted
+        float amount{ 0.0f };
+        float distance{ 0.0f };          // AssistAlert: for the log line
+        std::int32_t minDamage{ 0 };
+        std::int32_t maxDamage{ 0 };
+        std::string text;                // Log
+    };
+    struct NpcAiJob {
+        req::shared::data::ZoneNpc* npc{ nullptr };
+        float dt{ 0.0f };
+        // The NPC's own fields after the step
+        float posX{ 0.0f };
+        float posY{ 0.0f };
+        float posZ{ 0.0f };
+        float facingDegrees{ 0.0f };
+        float aggroScanTimer{ 0.0f };
+        float meleeAttackTimer{ 0.0f };
+        std::int32_t currentHp{ 0 };
+        req::shared::data::NpcAiState aiState{ req::shared::data::NpcAiState::Idle };
+        std::vector<NpcAiCommand> commands;  // Kept across ticks for their capacity
+    };
+    void runNpcAiPhase(std::size_t jobCount);
+    void evaluateNpcAi(NpcAiJob& job) const;
+    void applyNpcAiCommand(const NpcAiCommand& command);
+    
+    // NPC level of detail: seconds of simulation to run for this NPC now
+    // (0 = skip it this tick; the time is kept and handed over later)
+    float npcSimulationStep(req::shared::data::ZoneNpc& npc, float deltaSeconds);
+    req::shared::data::NpcActivity classifyNpcActivity(const req::shared::data::ZoneNpc& npc) const;
     
     // Spawn Manager methods
     void initializeSpawnRecords();
-    void processSpawns(float deltaSeconds, double currentTime);
+    void processSpawnTimer(std::int32_t spawnPointId, double currentTime);
     void spawnNpcAtPoint(SpawnRecord& record, double currentTime);
     void scheduleRespawn(std::int32_t spawnPointId, double currentTime);
+    void noteSpawnDue(const SpawnRecord& record);  // Put the record's next_spawn_time on timers_
+    void checkSpawnIntegrity(double currentTime);
+    
+    // Zone deadlines (spawns, corpse expiry, periodic checks)
+    void scheduleTimer(ZoneTimerKind kind, std::uint64_t id, double dueTime);
+    void processTimers(double currentTime);
     
     // Hate/Aggro system (Phase 2.3)
     void addHate(req::shared::data::ZoneNpc& npc, std::uint64_t entityId, float amount);
     std::uint64_t getTopHateTarget(const req::shared::data::ZoneNpc& npc) const;
     void clearHate(req::shared::data::ZoneNpc& npc);
     void removeCharacterFromAllHateTables(std::uint64_t characterId);
+    void unindexHate(const req::shared::data::ZoneNpc& npc);  // Drop npc's entries from hatedBy_
     
     // Combat
     void processAttack(ZonePlayer& attacker, req::shared::data::ZoneNpc& target, 
@@ -187,7 +408,7 @@ private:
     // Death and respawn
     void handlePlayerDeath(ZonePlayer& player);
     void respawnPlayer(ZonePlayer& player);
-    void processCorpseDecay();
+    void expireCorpse(std::uint64_t corpseId, double currentTime);
     
     // Dev commands (for testing)
     void devGiveXp(std::uint64_t characterId, std::int64_t amount);
@@ -227,17 +448,61 @@ private:
     // Group XP sharing (Phase 3)
     void awardXpForNpcKill(req::shared::data::ZoneNpc& target, ZonePlayer& attacker);
     
+    // Name lookups (invites, future /tell and /who): case-insensitive, over
+    // players in this zone only. ZoneAuth indexes, removePlayer unindexes.
+    void indexCharacterName(const ZonePlayer& player);
+    void unindexCharacterName(const ZonePlayer& player);
+    std::optional<std::uint64_t> findCharacterIdByName(std::string_view name) const;
+    
     // Player disconnect handling
     void removePlayer(std::uint64_t characterId);
     void onConnectionClosed(ConnectionPtr connection);
     
+    // Cork/uncork all connections (batches a tick's sends into one write each)
+    void setConnectionsCorked(bool corked);
+    
+    // Wire format negotiated for this connection (Text until ZoneAuth completes)
+    req::shared::protocol::WireFormat getWireFormat(const ConnectionPtr& connection) const;
+    
+    // Zone quantization params if the player negotiated QuantizedState, else nullptr
+    const req::shared::protocol::QuantizationParams* getQuantization(const ZonePlayer& player) const;
+    const req::shared::protocol::QuantizationParams* getQuantization(const ConnectionPtr& connection) const;
+    
+    // UDP side-channel: snapshot-class frames go over UDP when the player's
+    // channel is active, otherwise (or if too large) over the TCP connection
+    void startDatagramChannel();
+    void sendUnreliable(const ConnectionPtr& connection, const req::shared::net::Connection::SharedFrame& frame);
+    
+    // Latency service (Ping/Pong): pings go out every zoneConfig_.pingIntervalSec,
+    // Pongs update ZonePlayer::latency. The getters return nullopt until the
+    // player has answered a ping.
+    std::uint64_t serverTimeMs() const;
+    void sendLatencyProbes();
+    void handlePong(const ConnectionPtr& connection, std::string_view payload, std::uint64_t receivedAtMs);
+    std::optional<float> getPlayerRttMs(std::uint64_t characterId) const;
+    std::optional<std::uint64_t> clientTimeToServerTimeMs(const ZonePlayer& player, std::uint64_t clientTimeMs) const;
+    
+    // Periodic network stats line / file (zoneConfig_.netStatsIntervalSec)
+    void scheduleNetStats();
+    void onNetStats(const boost::system::error_code& ec);
+    std::string buildNetStatsReport() const;
+    void onDatagramMessage(std::uint64_t characterId,
+                           const req::shared::MessageHeader& header,
+                           std::string_view payload);
+    
     // Simulation tick
     void scheduleNextTick();
     void onTick(const boost::system::error_code& ec);
+    void resetTickSchedule();
+    void logTickStats();
     void updateSimulation(float dt);
+    void syncPlayerMotion(ZonePlayer& player);
+    void removePlayerMotion(ZonePlayer& player);
     void broadcastSnapshots();
+    void sendDeltaSnapshot(ZonePlayer& recipient, const req::shared::protocol::PlayerStateSnapshotData& snapshot);
     
     // Entity spawn/update/despawn broadcasting
+    bool buildEntitySpawnData(std::uint64_t entityId, req::shared::protocol::EntitySpawnData& outData) const;
     void sendEntitySpawn(ConnectionPtr connection, std::uint64_t entityId);
     void broadcastEntitySpawn(std::uint64_t entityId);
     void sendEntityUpdate(ConnectionPtr connection, std::uint64_t entityId);
@@ -250,9 +515,24 @@ private:
     void scheduleAutosave();
     void onAutosave(const boost::system::error_code& ec);
 
-    boost::asio::io_context  ioContext_{};
+    std::unique_ptr<boost::asio::io_context> ownedIoContext_;  // Null for a hosted zone
+    boost::asio::io_context& ioContext_;
+    // Everything that touches zone state (accept, tick, autosave, inbound
+    // message/disconnect handling) runs on this strand
+    boost::asio::strand<boost::asio::io_context::executor_type> simStrand_;
     Tcp::acceptor            acceptor_;
     std::vector<ConnectionPtr> connections_{};
+    
+    // Network I/O threads (zoneConfig_.ioThreads, fixed when run() starts)
+    std::uint32_t            ioThreadCount_{ 0 };
+    std::vector<std::thread> ioThreads_{};
+    req::shared::MpscQueue<InboundEvent> inboundEvents_{};
+    
+    // Optional UDP side-channel (zoneConfig_.udpEnabled); null when disabled
+    std::unique_ptr<ZoneDatagramChannel> datagramChannel_;
+    
+    // Shared by every connection of this zone
+    std::shared_ptr<req::shared::net::NetMetrics> netMetrics_{ std::make_shared<req::shared::net::NetMetrics>() };
 
     std::uint32_t            worldId_{};
     std::uint32_t            zoneId_{};
@@ -277,26 +557,68 @@ private:
     // Character persistence
     req::shared::CharacterStore characterStore_;
     req::shared::AccountStore accountStore_;
+    std::unique_ptr<CharacterSaveQueue> ownedCharacterSaves_;  // Null for a hosted zone
+    CharacterSaveQueue& characterSaves_;  // Write-behind; all zone saves go here (the host's when hosted)
+    CharacterSaveQueue::FailureQueuePtr characterSaveFailures_{ std::make_shared<CharacterSaveQueue::FailureQueue>() };
     
     // Zone simulation state
     boost::asio::steady_timer tickTimer_;
     boost::asio::steady_timer autosaveTimer_;
+    boost::asio::steady_timer netStatsTimer_;
+    std::chrono::steady_clock::time_point serverClockStart_{ std::chrono::steady_clock::now() };
     std::uint64_t snapshotCounter_{ 0 };
-    std::unordered_map<std::uint64_t, ZonePlayer> players_;
+    std::uint64_t simulationTick_{ 0 };  // updateSimulation calls so far
+    
+    // Per-zone counters and RNG (no function statics: several zones can share a process)
+    std::uint64_t npcLogCounter_{ 0 };
+    std::uint64_t movementParseErrors_{ 0 };  // Since the last rate-limited log line
+    std::chrono::steady_clock::time_point lastMovementParseErrorLog_{ std::chrono::steady_clock::now() };
+    std::mt19937 rng_{ std::random_device{}() };  // Hit and damage rolls
+    
+    // Tick schedule: deadline n is tickEpoch_ + n * tickPeriod_, so the loop
+    // keeps wall-clock pace no matter how long each tick takes
+    float tickRateHz_{ 0.0f };  // Rate the schedule was built for; a config change re-anchors it
+    float tickDt_{ 0.05f };
+    std::uint64_t ticksPerSecond_{ 20 };  // For "once a second" work counted in ticks
+    std::chrono::steady_clock::duration tickPeriod_{};
+    std::chrono::steady_clock::time_point tickEpoch_{};
+    std::uint64_t tickIndex_{ 0 };  // Deadline the pending wake-up is for
+    TickStats tickStats_;
+    std::chrono::steady_clock::time_point nextTickStatsReport_{};
+    // Entity tables are DenseMaps (SlotMap.h): contiguous iteration in a deterministic
+    // order. References into them do not survive an insert or erase on the same table.
+    req::shared::DenseMap<std::uint64_t, ZonePlayer> players_;
     std::unordered_map<ConnectionPtr, std::uint64_t> connectionToCharacterId_;
+    std::unordered_map<std::string, std::uint64_t> characterIdByName_;  // Lowercased name -> characterId
+    
+    // Initialized players by XY position; cell size = interestRadius
+    SpatialGrid playerGrid_;
+    
+    // Hot movement fields of every player, one row each (see ZonePlayer)
+    req::shared::MotionTable playerMotion_;
     
     // NPCs in this zone
-    std::unordered_map<std::uint64_t, req::shared::data::ZoneNpc> npcs_;
+    req::shared::DenseMap<std::uint64_t, req::shared::data::ZoneNpc> npcs_;
+    SpatialGrid npcGrid_;  // Alive NPCs by XY position (aggro / social assist queries)
+    std::unordered_map<std::uint64_t, std::vector<std::uint64_t>> hatedBy_;  // entityId -> NPCs with it on their hate table
+    std::vector<NpcAiJob> npcAiJobs_;  // This tick's AI jobs (first jobCount entries are live)
+    std::unique_ptr<boost::asio::thread_pool> ownedNpcAiPool_;  // Standalone only (zoneConfig_.npcAiThreads)
+    boost::asio::thread_pool* npcAiPool_{ nullptr };  // Owned or the host's; null = AI on the simulation strand
+    std::uint32_t npcAiWorkers_{ 0 };  // Threads in *npcAiPool_
     std::uint64_t nextNpcInstanceId_{ 1 };  // Counter for unique NPC instance IDs
     
     // Spawn Manager state
-    std::unordered_map<std::int32_t, SpawnRecord> spawnRecords_;  // spawn_point_id -> SpawnRecord
+    req::shared::DenseMap<std::int32_t, SpawnRecord> spawnRecords_;  // spawn_point_id -> SpawnRecord
     bool enableSpawnDebugLogging_{ false };  // Toggle for verbose spawn logs
     
     // Corpses in this zone
-    std::unordered_map<std::uint64_t, req::shared::data::Corpse> corpses_;
+    req::shared::DenseMap<std::uint64_t, req::shared::data::Corpse> corpses_;
     std::uint64_t nextCorpseId_{ 1 };
     
+    // Absolute deadlines in epoch seconds; each tick handles only the due ones
+    TimerWheel timers_;
+    std::vector<TimerWheel::Timer> dueTimers_;
+    
     // Groups in this zone (Phase 3)
     std::unordered_map<std::uint64_t, req::shared::data::Group> groups_;
     std::uint64_t nextGroupId_{ 1 };
@@ -0,0 +1,154 @@
+#include "../include/req/zone/CharacterSaveQueue.h"
+
+#include <algorithm>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+
+namespace req::zone {
+
+CharacterSaveQueue::CharacterSaveQueue(const req::shared::CharacterStore& store)
+    : store_(store) {
+    worker_ = std::thread([this]() {
+        workerLoop();
+    });
+}
+
+CharacterSaveQueue::~CharacterSaveQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    workAvailable_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+
+    if (!failed_.empty()) {
+        req::shared::logError("zone", std::string{"[SAVE] "} + std::to_string(failed_.size()) +
+            " character save(s) still failing at shutdown; their latest state was not written");
+    }
+}
+
+void CharacterSaveQueue::submit(req::shared::data::Character snapshot, FailureQueuePtr failures) {
+    const std::uint64_t characterId = snapshot.characterId;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.submitted;
+        failed_.erase(characterId);
+
+        auto it = waiting_.find(characterId);
+        if (it != waiting_.end()) {
+            it->second = Entry{ std::move(snapshot), std::move(failures) };
+            ++stats_.coalesced;
+            return;
+        }
+        waiting_.emplace(characterId, Entry{ std::move(snapshot), std::move(failures) });
+        order_.push_back(characterId);
+        stats_.maxPending = std::max(stats_.maxPending, waiting_.size() + writing_.size());
+    }
+    workAvailable_.notify_one();
+}
+
+std::optional<req::shared::data::Character> CharacterSaveQueue::latest(std::uint64_t characterId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Newest first: waiting replaces writing, which replaces a failed write
+    if (auto it = waiting_.find(characterId); it != waiting_.end()) {
+        return it->second.snapshot;
+    }
+    if (auto it = writing_.find(characterId); it != writing_.end()) {
+        return it->second.snapshot;
+    }
+    if (auto it = failed_.find(characterId); it != failed_.end()) {
+        return it->second.snapshot;
+    }
+    return std::nullopt;
+}
+
+std::size_t CharacterSaveQueue::retryFailed() {
+    std::size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [characterId, entry] : failed_) {
+            // A newer snapshot is already on its way
+            if (waiting_.count(characterId) != 0 || writing_.count(characterId) != 0) {
+                continue;
+            }
+            waiting_.emplace(characterId, std::move(entry));
+            order_.push_back(characterId);
+            ++count;
+        }
+        failed_.clear();
+        stats_.maxPending = std::max(stats_.maxPending, waiting_.size() + writing_.size());
+    }
+    if (count > 0) {
+        workAvailable_.notify_one();
+    }
+    return count;
+}
+
+void CharacterSaveQueue::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() {
+        return waiting_.empty() && writing_.empty();
+    });
+}
+
+CharacterSaveQueue::Stats CharacterSaveQueue::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.pending = waiting_.size() + writing_.size();
+    stats.failedHeld = failed_.size();
+    return stats;
+}
+
+void CharacterSaveQueue::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        workAvailable_.wait(lock, [this]() {
+            return stopping_ || !order_.empty();
+        });
+        if (order_.empty()) {
+            return;  // Stopping with nothing left to write
+        }
+
+        std::uint64_t characterId = order_.front();
+        order_.pop_front();
+        auto waitingIt = waiting_.find(characterId);
+        const auto& snapshot = writing_.emplace(characterId, std::move(waitingIt->second)).first->second.snapshot;
+        waiting_.erase(waitingIt);
+
+        // The snapshot stays visible through latest() until the file is
+        // closed, so nobody reads the file while it is being rewritten
+        lock.unlock();
+        bool ok = false;
+        try {
+            ok = store_.saveCharacter(snapshot);
+        } catch (const std::exception& e) {
+            req::shared::logError("zone", std::string{"[SAVE] Exception writing character: characterId="} +
+                std::to_string(characterId) + ", error: " + e.what());
+        }
+        lock.lock();
+
+        auto writingIt = writing_.find(characterId);
+        if (ok) {
+            ++stats_.written;
+        } else {
+            ++stats_.failed;
+            if (writingIt->second.failures) {
+                writingIt->second.failures->push(Failure{ characterId });
+            }
+            // Keep it for a retry unless a newer snapshot is already waiting
+            if (waiting_.count(characterId) == 0) {
+                failed_[characterId] = std::move(writingIt->second);
+            }
+        }
+        writing_.erase(writingIt);
+
+        if (waiting_.empty()) {
+            idle_.notify_all();
+        }
+    }
+}
+
+} // namespace req::zone
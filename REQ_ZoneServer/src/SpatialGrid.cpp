@@ -0,0 +1,81 @@
+#include "../include/req/zone/SpatialGrid.h"
+
+namespace req::zone {
+
+namespace {
+    constexpr float DEFAULT_CELL_SIZE = 100.0f;
+}
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : cellSize_(cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE),
+      inverseCellSize_(1.0f / cellSize_) {
+}
+
+void SpatialGrid::reset(float cellSize) {
+    clear();
+    cellSize_ = cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE;
+    inverseCellSize_ = 1.0f / cellSize_;
+}
+
+void SpatialGrid::clear() {
+    cells_.clear();
+    entities_.clear();
+}
+
+bool SpatialGrid::update(std::uint64_t id, float x, float y) {
+    const std::uint64_t key = cellKey(cellCoord(x), cellCoord(y));
+
+    auto it = entities_.find(id);
+    if (it != entities_.end()) {
+        Location& location = it->second;
+        if (location.cellKey == key) {
+            Item& item = cells_[key][location.index];
+            item.x = x;
+            item.y = y;
+            return false;
+        }
+        removeFromCell(location.cellKey, location.index);
+    }
+
+    auto& items = cells_[key];
+    items.push_back(Item{ id, x, y });
+    entities_[id] = Location{ key, items.size() - 1 };
+    return true;
+}
+
+void SpatialGrid::remove(std::uint64_t id) {
+    auto it = entities_.find(id);
+    if (it == entities_.end()) {
+        return;
+    }
+    Location location = it->second;
+    entities_.erase(it);
+    removeFromCell(location.cellKey, location.index);
+}
+
+void SpatialGrid::queryRadius(float x, float y, float radius, std::vector<std::uint64_t>& outIds) const {
+    forEachInRadius(x, y, radius, [&outIds](std::uint64_t id, float, float) {
+        outIds.push_back(id);
+    });
+}
+
+void SpatialGrid::removeFromCell(std::uint64_t key, std::size_t index) {
+    auto cellIt = cells_.find(key);
+    if (cellIt == cells_.end()) {
+        return;
+    }
+    auto& items = cellIt->second;
+
+    // Swap-remove; the entity moved into the hole needs its index fixed
+    if (index + 1 != items.size()) {
+        items[index] = items.back();
+        entities_[items[index].id].index = index;
+    }
+    items.pop_back();
+
+    if (items.empty()) {
+        cells_.erase(cellIt);
+    }
+}
+
+} // namespace req::zone
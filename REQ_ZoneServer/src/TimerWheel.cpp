@@ -0,0 +1,174 @@
+#include "../include/req/zone/TimerWheel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace req::zone {
+
+namespace {
+    constexpr double DEFAULT_RESOLUTION = 0.05;
+    constexpr double MAX_SLOT = 1.0e18;  // Keeps absurd due times representable
+}
+
+TimerWheel::TimerWheel(double resolution)
+    : resolution_(resolution > 0.0 ? resolution : DEFAULT_RESOLUTION) {
+}
+
+void TimerWheel::reset(double now) {
+    std::vector<Entry> pending;
+    pending.reserve(size_);
+    for (auto& level : levels_) {
+        for (auto& slot : level) {
+            pending.insert(pending.end(), slot.begin(), slot.end());
+            slot.clear();
+        }
+    }
+    pending.insert(pending.end(), overflow_.begin(), overflow_.end());
+    pending.insert(pending.end(), ready_.begin(), ready_.end());
+    overflow_.clear();
+    ready_.clear();
+
+    anchor(now);
+    for (const Entry& entry : pending) {
+        file(entry);
+    }
+}
+
+void TimerWheel::clear() {
+    for (auto& level : levels_) {
+        for (auto& slot : level) {
+            slot.clear();
+        }
+    }
+    overflow_.clear();
+    ready_.clear();
+    size_ = 0;
+}
+
+void TimerWheel::schedule(double dueTime, std::uint32_t kind, std::uint64_t id) {
+    if (!anchored_) {
+        anchor(dueTime);
+    }
+    file(Entry{ Timer{ dueTime, kind, id }, nextSequence_++ });
+    ++size_;
+}
+
+void TimerWheel::advance(double now, std::vector<Timer>& due) {
+    if (!anchored_) {
+        anchor(now);
+    }
+
+    std::uint64_t target = now <= origin_ ? 0 : static_cast<std::uint64_t>(std::min(std::floor((now - origin_) / resolution_), MAX_SLOT));
+    firing_.clear();
+
+    if (target > currentSlot_ + SlotCount * SlotCount) {
+        // Long stall: re-file once rather than walking every slot in between
+        refileAll(target);
+    }
+
+    while (currentSlot_ < target) {
+        ++currentSlot_;
+
+        // Top level first, so timers cascading down land in slots that are
+        // cascaded or fired later in this same step
+        for (int level = LevelCount; level >= 1; --level) {
+            const std::uint64_t mask = (std::uint64_t{ 1 } << (SlotBits * level)) - 1;
+            if ((currentSlot_ & mask) != 0) {
+                continue;
+            }
+            if (level == LevelCount) {
+                std::vector<Entry> waiting;
+                waiting.swap(overflow_);
+                for (const Entry& entry : waiting) {
+                    file(entry);
+                }
+            } else {
+                cascade(level, static_cast<std::size_t>((currentSlot_ >> (SlotBits * level)) & (SlotCount - 1)));
+            }
+        }
+
+        auto& slot = levels_[0][currentSlot_ & (SlotCount - 1)];
+        firing_.insert(firing_.end(), slot.begin(), slot.end());
+        slot.clear();
+    }
+
+    collect(ready_, now, firing_);
+    if (firing_.empty()) {
+        return;
+    }
+
+    std::sort(firing_.begin(), firing_.end(), [](const Entry& a, const Entry& b) {
+        return a.timer.dueTime != b.timer.dueTime ? a.timer.dueTime < b.timer.dueTime : a.sequence < b.sequence;
+    });
+    for (const Entry& entry : firing_) {
+        due.push_back(entry.timer);
+    }
+    size_ -= firing_.size();
+    firing_.clear();
+}
+
+std::uint64_t TimerWheel::slotFor(double time) const {
+    if (!(time > origin_)) {
+        return 0;
+    }
+    return static_cast<std::uint64_t>(std::min(std::ceil((time - origin_) / resolution_), MAX_SLOT));
+}
+
+void TimerWheel::anchor(double now) {
+    origin_ = now;
+    currentSlot_ = 0;
+    anchored_ = true;
+}
+
+void TimerWheel::file(Entry entry) {
+    std::uint64_t slot = slotFor(entry.timer.dueTime);
+    if (slot <= currentSlot_) {
+        ready_.push_back(entry);
+        return;
+    }
+
+    std::uint64_t delta = slot - currentSlot_;
+    for (int level = 0; level < LevelCount; ++level) {
+        if (delta < (std::uint64_t{ 1 } << (SlotBits * (level + 1)))) {
+            levels_[level][(slot >> (SlotBits * level)) & (SlotCount - 1)].push_back(entry);
+            return;
+        }
+    }
+    overflow_.push_back(entry);
+}
+
+void TimerWheel::refileAll(std::uint64_t newSlot) {
+    std::vector<Entry> pending;
+    for (auto& level : levels_) {
+        for (auto& slot : level) {
+            pending.insert(pending.end(), slot.begin(), slot.end());
+            slot.clear();
+        }
+    }
+    pending.insert(pending.end(), overflow_.begin(), overflow_.end());
+    overflow_.clear();
+
+    currentSlot_ = newSlot;
+    for (const Entry& entry : pending) {
+        file(entry);
+    }
+}
+
+void TimerWheel::cascade(int level, std::size_t index) {
+    std::vector<Entry> moving;
+    moving.swap(levels_[level][index]);
+    for (const Entry& entry : moving) {
+        file(entry);
+    }
+}
+
+void TimerWheel::collect(std::vector<Entry>& from, double now, std::vector<Entry>& out) {
+    // Anything filed as "ready" before the wheel was anchored may still lie ahead
+    auto notDue = std::partition(from.begin(), from.end(), [now](const Entry& entry) {
+        return entry.timer.dueTime <= now;
+    });
+    out.insert(out.end(), from.begin(), notDue);
+    from.erase(from.begin(), notDue);
+}
+
+} // namespace req::zone
@@ -0,0 +1,222 @@
+#include "../include/req/zone/ZoneDatagramChannel.h"
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+
+namespace req::zone {
+
+namespace {
+    std::string endpointToString(const boost::asio::ip::udp::endpoint& endpoint) {
+        return endpoint.address().to_string() + ":" + std::to_string(endpoint.port());
+    }
+}
+
+ZoneDatagramChannel::ZoneDatagramChannel(const boost::asio::any_io_executor& executor,
+                                         float sessionTimeoutSec,
+                                         float simulatedLossPercent)
+    : socket_(executor),
+      sessionTimeout_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<float>(sessionTimeoutSec))),
+      simulatedLossPercent_(simulatedLossPercent) {
+}
+
+bool ZoneDatagramChannel::open(const std::string& address, std::uint16_t port) {
+    boost::system::error_code ec;
+    Udp::endpoint endpoint(boost::asio::ip::make_address(address, ec), port);
+    if (ec) {
+        req::shared::logError("zone", std::string{"[UDP] Invalid listen address: "} + ec.message());
+        return false;
+    }
+
+    socket_.open(endpoint.protocol(), ec);
+    if (ec) {
+        req::shared::logError("zone", std::string{"[UDP] socket open failed: "} + ec.message());
+        return false;
+    }
+    socket_.bind(endpoint, ec);
+    if (ec) {
+        req::shared::logError("zone", std::string{"[UDP] bind failed on port "} + std::to_string(port) + ": " + ec.message());
+        socket_.close(ec);
+        return false;
+    }
+
+    localPort_ = socket_.local_endpoint(ec).port();
+    req::shared::logInfo("zone", std::string{"[UDP] Side-channel listening on "} + address + ":" +
+        std::to_string(localPort_) + " (timeout=" +
+        std::to_string(std::chrono::duration<float>(sessionTimeout_).count()) + "s, simulatedLoss=" +
+        std::to_string(simulatedLossPercent_) + "%)");
+    return true;
+}
+
+void ZoneDatagramChannel::start() {
+    doReceive();
+}
+
+void ZoneDatagramChannel::close() {
+    boost::system::error_code ec;
+    socket_.close(ec);
+    sessions_.clear();
+}
+
+void ZoneDatagramChannel::addSession(std::uint64_t characterId, std::uint64_t sessionKey) {
+    Session session;
+    session.sessionKey = sessionKey;
+    sessions_[characterId] = session;
+}
+
+void ZoneDatagramChannel::removeSession(std::uint64_t characterId) {
+    sessions_.erase(characterId);
+}
+
+bool ZoneDatagramChannel::isActive(std::uint64_t characterId) {
+    auto it = sessions_.find(characterId);
+    if (it == sessions_.end() || !it->second.bound) {
+        return false;
+    }
+
+    auto& session = it->second;
+    if (std::chrono::steady_clock::now() - session.lastReceive > sessionTimeout_) {
+        // Client went quiet: use TCP until it sends another Hello
+        session.bound = false;
+        req::shared::logInfo("zone", std::string{"[UDP] Session timed out, falling back to TCP: characterId="} +
+            std::to_string(characterId));
+        return false;
+    }
+    return true;
+}
+
+bool ZoneDatagramChannel::sendFrame(std::uint64_t characterId, const req::shared::net::Connection::SharedFrame& frame) {
+    if (!frame || req::shared::protocol::DatagramHeaderBytes + frame->size() > req::shared::protocol::MaxDatagramBytes) {
+        return false;
+    }
+    if (!isActive(characterId)) {
+        return false;
+    }
+
+    auto& session = sessions_[characterId];
+    req::shared::protocol::DatagramHeader header;
+    header.kind = req::shared::protocol::DatagramKind::Message;
+    header.characterId = characterId;
+    header.sessionKey = session.sessionKey;
+    header.sequence = ++session.sendSequence;
+
+    std::string_view frameBytes(reinterpret_cast<const char*>(frame->data()), frame->size());
+    sendDatagram(session.endpoint, req::shared::protocol::buildDatagram(header, frameBytes));
+    return true;
+}
+
+void ZoneDatagramChannel::doReceive() {
+    socket_.async_receive_from(
+        boost::asio::buffer(receiveBuffer_), senderEndpoint_,
+        [this](const boost::system::error_code& ec, std::size_t bytes) {
+            if (ec == boost::asio::error::operation_aborted || !socket_.is_open()) {
+                return;
+            }
+            if (!ec) {
+                handleDatagram(std::string_view(receiveBuffer_.data(), bytes), senderEndpoint_);
+            } else {
+                // ICMP port unreachable etc. surface here on some platforms; keep listening
+                req::shared::logWarn("zone", std::string{"[UDP] receive error: "} + ec.message());
+            }
+            doReceive();
+        });
+}
+
+void ZoneDatagramChannel::handleDatagram(std::string_view datagram, const Udp::endpoint& sender) {
+    if (datagram.size() > req::shared::protocol::MaxDatagramBytes) {
+        ++stats_.datagramsRejected;
+        return;
+    }
+    if (dropForSimulatedLoss()) {
+        return;
+    }
+
+    req::shared::protocol::DatagramHeader header;
+    req::shared::MessageHeader messageHeader;
+    std::string_view payload;
+    if (!req::shared::protocol::parseDatagram(datagram, header, messageHeader, payload)) {
+        ++stats_.datagramsRejected;
+        return;
+    }
+
+    auto it = sessions_.find(header.characterId);
+    if (it == sessions_.end() || it->second.sessionKey != header.sessionKey) {
+        ++stats_.datagramsRejected;
+        return;
+    }
+    auto& session = it->second;
+
+    switch (header.kind) {
+    case req::shared::protocol::DatagramKind::Hello: {
+        if (!session.bound || session.endpoint != sender) {
+            req::shared::logInfo("zone", std::string{"[UDP] Session bound: characterId="} +
+                std::to_string(header.characterId) + ", endpoint=" + endpointToString(sender));
+        }
+        session.endpoint = sender;
+        session.bound = true;
+        session.lastReceive = std::chrono::steady_clock::now();
+        ++stats_.datagramsReceived;
+
+        req::shared::protocol::DatagramHeader ack;
+        ack.kind = req::shared::protocol::DatagramKind::HelloAck;
+        ack.characterId = header.characterId;
+        ack.sessionKey = session.sessionKey;
+        ack.sequence = ++session.sendSequence;
+        sendDatagram(sender, req::shared::protocol::buildDatagram(ack));
+        break;
+    }
+    case req::shared::protocol::DatagramKind::Message: {
+        // Messages are only taken from the endpoint that completed the Hello
+        if (!session.bound || session.endpoint != sender) {
+            ++stats_.datagramsRejected;
+            return;
+        }
+        if (session.hasReceivedMessage &&
+            !req::shared::protocol::isNewerDatagramSequence(header.sequence, session.lastReceiveSequence)) {
+            ++stats_.datagramsStale;
+            return;
+        }
+        session.hasReceivedMessage = true;
+        session.lastReceiveSequence = header.sequence;
+        session.lastReceive = std::chrono::steady_clock::now();
+        ++stats_.datagramsReceived;
+
+        if (onMessage_) {
+            onMessage_(header.characterId, messageHeader, payload);
+        }
+        break;
+    }
+    default:
+        ++stats_.datagramsRejected;
+        break;
+    }
+}
+
+void ZoneDatagramChannel::sendDatagram(const Udp::endpoint& endpoint, std::string datagram) {
+    if (dropForSimulatedLoss()) {
+        return;
+    }
+
+    ++stats_.datagramsSent;
+    auto buffer = std::make_shared<std::string>(std::move(datagram));
+    socket_.async_send_to(
+        boost::asio::buffer(*buffer), endpoint,
+        [buffer](const boost::system::error_code& ec, std::size_t /*bytes*/) {
+            if (ec && ec != boost::asio::error::operation_aborted) {
+                req::shared::logWarn("zone", std::string{"[UDP] send error: "} + ec.message());
+            }
+        });
+}
+
+bool ZoneDatagramChannel::dropForSimulatedLoss() {
+    if (simulatedLossPercent_ <= 0.0f) {
+        return false;
+    }
+    std::uniform_real_distribution<float> dist(0.0f, 100.0f);
+    if (dist(lossRng_) < simulatedLossPercent_) {
+        ++stats_.simulatedLossDrops;
+        return true;
+    }
+    return false;
+}
+
+} // namespace req::zone
@@ -0,0 +1,80 @@
+#include "../include/req/zone/ZoneHost.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+
+namespace req::zone {
+
+ZoneHost::ZoneHost(std::uint32_t worldId,
+                   std::string address,
+                   req::shared::WorldRules worldRules,
+                   req::shared::XpTable xpTable,
+                   std::string charactersPath,
+                   std::uint32_t threadCount,
+                   std::uint32_t aiThreadCount)
+    : worldId_(worldId), address_(std::move(address)), worldRules_(std::move(worldRules)),
+      xpTable_(std::move(xpTable)), charactersPath_(std::move(charactersPath)),
+      threadCount_(threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency())),
+      aiThreadCount_(aiThreadCount), characterStore_(charactersPath_), characterSaves_(characterStore_) {
+    if (aiThreadCount_ > 0) {
+        npcAiPool_ = std::make_unique<boost::asio::thread_pool>(aiThreadCount_);
+    }
+}
+
+void ZoneHost::addZone(const ZoneSpec& spec) {
+    for (const auto& existing : specs_) {
+        if (existing.zoneId == spec.zoneId || existing.port == spec.port) {
+            std::string msg = "ZoneHost: zone " + std::to_string(spec.zoneId) + " (port " +
+                std::to_string(spec.port) + ") clashes with zone " + std::to_string(existing.zoneId) +
+                " (port " + std::to_string(existing.port) + ")";
+            req::shared::logError("zonehost", msg);
+            throw std::runtime_error(msg);
+        }
+    }
+
+    specs_.push_back(spec);
+    zones_.push_back(std::make_unique<ZoneServer>(ioContext_, characterSaves_, npcAiPool_.get(), aiThreadCount_, worldId_, spec.zoneId, spec.zoneName,
+        address_, spec.port, worldRules_, xpTable_, charactersPath_));
+}
+
+void ZoneHost::run() {
+    req::shared::logInfo("zonehost", std::string{"Starting "} + std::to_string(zones_.size()) +
+        " zone(s) on " + std::to_string(threadCount_) + " shared thread(s), " +
+        std::to_string(aiThreadCount_) + " shared NPC AI thread(s)");
+
+    for (auto& zone : zones_) {
+        zone->start();
+    }
+
+    // The calling thread is one of the pool
+    for (std::uint32_t i = 1; i < threadCount_; ++i) {
+        threads_.emplace_back([this]() {
+            ioContext_.run();
+        });
+    }
+    ioContext_.run();
+
+    for (auto& thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    threads_.clear();
+
+    auto saveStats = characterSaves_.stats();
+    if (saveStats.pending > 0) {
+        req::shared::logInfo("zonehost", std::string{"Waiting for "} + std::to_string(saveStats.pending) +
+            " queued character save(s)...");
+    }
+    characterSaves_.flush();
+    req::shared::logInfo("zonehost", "Zone host stopped");
+}
+
+void ZoneHost::stop() {
+    req::shared::logInfo("zonehost", "Zone host shutdown requested");
+    ioContext_.stop();
+}
+
+} // namespace req::zone
@@ -13,6 +13,11 @@
 
 namespace req::zone {
 
+namespace {
+    // NPC grid cells; on the order of typical aggro / assist radii
+    constexpr float NPC_GRID_CELL_SIZE = 500.0f;
+}
+
 ZoneServer::ZoneServer(std::uint32_t worldId,
                        std::uint32_t zoneId,
                        const std::string& zoneName,
@@ -21,10 +26,50 @@ ZoneServer::ZoneServer(std::uint32_t worldId,
                        const req::shared::WorldRules& worldRules,
                        const req::shared::XpTable& xpTable,
                        const std::string& charactersPath)
-    : acceptor_(ioContext_), tickTimer_(ioContext_), autosaveTimer_(ioContext_),
+    : ZoneServer(std::make_unique<boost::asio::io_context>(), nullptr, nullptr, nullptr, 0, worldId, zoneId, zoneName,
+                 address, port, worldRules, xpTable, charactersPath) {
+}
+
+ZoneServer::ZoneServer(boost::asio::io_context& sharedIoContext,
+                       CharacterSaveQueue& sharedCharacterSaves,
+                       boost::asio::thread_pool* sharedNpcAiPool,
+                       std::uint32_t npcAiThreads,
+                       std::uint32_t worldId,
+                       std::uint32_t zoneId,
+                       const std::string& zoneName,
+                       const std::string& address,
+                       std::uint16_t port,
+                       const req::shared::WorldRules& worldRules,
+                       const req::shared::XpTable& xpTable,
+                       const std::string& charactersPath)
+    : ZoneServer(nullptr, &sharedIoContext, &sharedCharacterSaves, sharedNpcAiPool, npcAiThreads, worldId, zoneId, zoneName,
+                 address, port, worldRules, xpTable, charactersPath) {
+}
+
+ZoneServer::ZoneServer(std::unique_ptr<boost::asio::io_context> ownedIoContext,
+                       boost::asio::io_context* sharedIoContext,
+                       CharacterSaveQueue* sharedCharacterSaves,
+                       boost::asio::thread_pool* sharedNpcAiPool,
+                       std::uint32_t sharedNpcAiThreads,
+                       std::uint32_t worldId,
+                       std::uint32_t zoneId,
+                       const std::string& zoneName,
+                       const std::string& address,
+                       std::uint16_t port,
+                       const req::shared::WorldRules& worldRules,
+                       const req::shared::XpTable& xpTable,
+                       const std::string& charactersPath)
+    : ownedIoContext_(std::move(ownedIoContext)),
+      ioContext_(sharedIoContext ? *sharedIoContext : *ownedIoContext_),
+      simStrand_(boost::asio::make_strand(ioContext_)), acceptor_(simStrand_),
+      tickTimer_(simStrand_), autosaveTimer_(simStrand_), netStatsTimer_(simStrand_),
       worldId_(worldId), zoneId_(zoneId), zoneName_(zoneName), 
       address_(address), port_(port), worldRules_(worldRules), xpTable_(xpTable),
-      characterStore_(charactersPath), accountStore_("data/accounts") {
+      characterStore_(charactersPath), accountStore_("data/accounts"),
+      ownedCharacterSaves_(sharedCharacterSaves ? nullptr : std::make_unique<CharacterSaveQueue>(characterStore_)),
+      characterSaves_(sharedCharacterSaves ? *sharedCharacterSaves : *ownedCharacterSaves_),
+      npcGrid_(NPC_GRID_CELL_SIZE), npcAiPool_(sharedNpcAiPool),
+      npcAiWorkers_(sharedNpcAiPool ? sharedNpcAiThreads : 0) {
     using boost::asio::ip::tcp;
     boost::system::error_code ec;
     tcp::endpoint endpoint(boost::asio::ip::make_address(address_, ec), port_);
@@ -72,6 +117,8 @@ ZoneServer::ZoneServer(std::uint32_t worldId,
             "), using defaults");
     }
     
+    playerGrid_.reset(zoneConfig_.interestRadius);
+    
     // Log ZoneServer construction
     req::shared::logInfo("zone", std::string{"ZoneServer constructed:"});
     req::shared::logInfo("zone", std::string{"  worldId="} + std::to_string(worldId_));
@@ -80,7 +127,7 @@ ZoneServer::ZoneServer(std::uint32_t worldId,
     req::shared::logInfo("zone", std::string{"  address="} + address_);
     req::shared::logInfo("zone", std::string{"  port="} + std::to_string(port_));
     req::shared::logInfo("zone", std::string{"  charactersPath="} + charactersPath);
-    req::shared::logInfo("zone", std::string{"  tickRate=20 Hz"});
+    req::shared::logInfo("zone", std::string{"  tickRate="} + std::to_string(zoneConfig_.tickRateHz) + " Hz");
     req::shared::logInfo("zone", std::string{"  moveSpeed="} + std::to_string(zoneConfig_.moveSpeed) + " uu/s");
     req::shared::logInfo("zone", std::string{"  broadcastFullState="} + 
         (zoneConfig_.broadcastFullState ? "true" : "false"));
@@ -100,10 +147,64 @@ ZoneServer::ZoneServer(std::uint32_t worldId,
 }
 
 void ZoneServer::run() {
+    start();
+    
+    // Extra threads only run connection I/O and hand inbound messages to the
+    // simulation strand; zone state is still mutated by one thread at a time
+    if (ioThreadCount_ > 0) {
+        req::shared::logInfo("zone", std::string{"Starting "} + std::to_string(ioThreadCount_) +
+            " network I/O thread(s); simulation runs on its own strand");
+        for (std::uint32_t i = 0; i < ioThreadCount_; ++i) {
+            ioThreads_.emplace_back([this]() {
+                ioContext_.run();
+            });
+        }
+    }
+    
+    req::shared::logInfo("zone", "Entering IO event loop...");
+    ioContext_.run();
+    
+    for (auto& thread : ioThreads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+    ioThreads_.clear();
+    
+    // Saves queued by the last ticks are still being written (standalone
+    // zones own their queue; a host flushes its shared one)
+    auto saveStats = characterSaves_.stats();
+    if (saveStats.pending > 0) {
+        req::shared::logInfo("zone", std::string{"Waiting for "} + std::to_string(saveStats.pending) +
+            " queued character save(s)...");
+    }
+    characterSaves_.flush();
+}
+
+void ZoneServer::start() {
     req::shared::logInfo("zone", std::string{"ZoneServer starting: worldId="} + 
         std::to_string(worldId_) + ", zoneId=" + std::to_string(zoneId_) + 
         ", zoneName=\"" + zoneName_ + "\", address=" + address_ + 
-        ", port=" + std::to_string(port_));
+        ", port=" + std::to_string(port_) + (ownedIoContext_ ? "" : " (hosted)"));
+    
+    // I/O thread count is fixed for the lifetime of the run; a hosted zone
+    // uses the host's threads instead
+    ioThreadCount_ = ownedIoContext_ ? zoneConfig_.ioThreads : 0;
+    
+    // NPC AI workers only evaluate; they never touch the io_context. A
+    // hosted zone uses the host's pool (or none) whatever its config says.
+    if (!ownedIoContext_) {
+        if (zoneConfig_.npcAiThreads > 0) {
+            req::shared::logInfo("zone", std::string{"npc_ai_threads="} + std::to_string(zoneConfig_.npcAiThreads) +
+                " ignored in a hosted zone; using the host's " + std::to_string(npcAiWorkers_) + " NPC AI thread(s)");
+        }
+    } else if (zoneConfig_.npcAiThreads > 0 && !ownedNpcAiPool_) {
+        req::shared::logInfo("zone", std::string{"Starting "} + std::to_string(zoneConfig_.npcAiThreads) +
+            " NPC AI thread(s) (parallel from " + std::to_string(zoneConfig_.npcAiParallelMin) + " NPCs per tick)");
+        ownedNpcAiPool_ = std::make_unique<boost::asio::thread_pool>(zoneConfig_.npcAiThreads);
+        npcAiPool_ = ownedNpcAiPool_.get();
+        npcAiWorkers_ = zoneConfig_.npcAiThreads;
+    }
     
     // Load NPC templates (global, shared across all zones)
     req::shared::logInfo("zone", "=== Loading NPC Data ===");
@@ -131,6 +232,7 @@ void ZoneServer::run() {
     loadNpcsForZone();
     
     startAccept();
+    startDatagramChannel();
     
     // Start the simulation tick loop
     scheduleNextTick();
@@ -141,13 +243,33 @@ void ZoneServer::run() {
     req::shared::logInfo("zone", std::string{"Position autosave enabled: interval="} +
         std::to_string(zoneConfig_.autosaveIntervalSec) + "s");
     
-    req::shared::logInfo("zone", "Entering IO event loop...");
-    ioContext_.run();
+    if (zoneConfig_.netStatsIntervalSec > 0.0f) {
+        scheduleNetStats();
+    }
 }
 
 void ZoneServer::stop() {
     req::shared::logInfo("zone", "ZoneServer shutdown requested");
-    ioContext_.stop();
+    if (ownedIoContext_) {
+        ioContext_.stop();
+        return;
+    }
+    
+    // Hosted: the io_context belongs to the host and keeps running other
+    // zones; wind down this zone's work on its own strand
+    boost::asio::post(simStrand_, [this]() {
+        boost::system::error_code ec;
+        acceptor_.close(ec);
+        tickTimer_.cancel();
+        autosaveTimer_.cancel();
+        netStatsTimer_.cancel();
+        if (datagramChannel_) {
+            datagramChannel_->close();
+        }
+        for (auto& connection : connections_) {
+            connection->close();
+        }
+    });
 }
 
 } // namespace req::zone
@@ -69,9 +69,8 @@ void ZoneServer::processAttack(ZonePlayer& attacker, req::shared::data::ZoneNpc&
     }
     
     // Calculate hit chance (simple: 95% hit for now)
-    static std::mt19937 rng(std::random_device{}());
     std::uniform_int_distribution<int> hitRoll(1, 100);
-    bool didHit = (hitRoll(rng) <= 95);
+    bool didHit = (hitRoll(rng_) <= 95);
     
     if (!didHit) {
         req::shared::logInfo("zone", std::string{"[COMBAT] Attack missed: attacker="} +
@@ -94,7 +93,7 @@ void ZoneServer::processAttack(ZonePlayer& attacker, req::shared::data::ZoneNpc&
     int baseDamage = 5 + (attacker.level * 2);
     int strengthBonus = attacker.strength / 10;
     std::uniform_int_distribution<int> damageVariance(-2, 5);
-    int variance = damageVariance(rng);
+    int variance = damageVariance(rng_);
     
     int totalDamage = baseDamage + strengthBonus + variance;
     totalDamage = std::max(1, totalDamage); // Minimum 1 damage
@@ -191,8 +190,10 @@ void ZoneServer::processAttack(ZonePlayer& attacker, req::shared::data::ZoneNpc&
 }
 
 void ZoneServer::broadcastAttackResult(const req::shared::protocol::AttackResultData& result) {
-    std::string payload = req::shared::protocol::buildAttackResultPayload(result);
-    req::shared::net::Connection::ByteArray payloadBytes(payload.begin(), payload.end());
+    // Encode once per wire format, only for formats some recipient actually uses.
+    // The resulting frame is shared by every recipient (no per-connection copy).
+    req::shared::net::Connection::SharedFrame textFrame;
+    req::shared::net::Connection::SharedFrame binaryFrame;
     
     req::shared::logInfo("zone", std::string{"[COMBAT] AttackResult: attacker="} +
         std::to_string(result.attackerId) + ", target=" + std::to_string(result.targetId) +
@@ -214,7 +215,13 @@ void ZoneServer::broadcastAttackResult(const req::shared::protocol::AttackResult
         }
         
         try {
-            connection->send(req::shared::MessageType::AttackResult, payloadBytes);
+            auto format = getWireFormat(connection);
+            auto& frame = (format == req::shared::protocol::WireFormat::Binary) ? binaryFrame : textFrame;
+            if (!frame) {
+                frame = req::shared::net::Connection::makeFrame(req::shared::MessageType::AttackResult,
+                    req::shared::protocol::buildAttackResultPayload(result, format));
+            }
+            connection->send(frame);
             sentCount++;
         } catch (const std::exception& e) {
             req::shared::logWarn("zone", std::string{"[COMBAT] Failed to send AttackResult to connection: "} + e.what());
@@ -277,19 +284,18 @@ void ZoneServer::awardXpForNpcKill(req::shared::data::ZoneNpc& target, ZonePlaye
         
         std::int64_t xpReward = static_cast<std::int64_t>(baseXpWithMods);
         
-        auto character = characterStore_.loadById(attacker.characterId);
-        if (character) {
-            std::uint32_t oldLevel = character->level;
-            std::uint64_t oldXp = character->xp;
+        // In memory only; the next save writes it
+        {
+            auto& character = attacker.character;
+            std::uint32_t oldLevel = character.level;
+            std::uint64_t oldXp = character.xp;
             
-            req::shared::AddXp(*character, xpReward, xpTable_, worldRules_);
+            req::shared::AddXp(character, xpReward, xpTable_, worldRules_);
             
-            attacker.level = character->level;
-            attacker.xp = character->xp;
+            attacker.level = character.level;
+            attacker.xp = character.xp;
             attacker.combatStatsDirty = true;
             
-            characterStore_.saveCharacter(*character);
-            
             req::shared::logInfo("zone", std::string{"[COMBAT][XP] Solo kill: killer="} +
                 std::to_string(attacker.characterId) + ", npc=" + std::to_string(target.npcId) +
                 ", npcLevel=" + std::to_string(target.level) + ", baseXp=" + std::to_string(static_cast<int>(baseXp)) +
@@ -363,34 +369,28 @@ void ZoneServer::awardXpForNpcKill(req::shared::data::ZoneNpc& target, ZonePlaye
         
         // Award XP to each eligible member
         for (std::uint64_t memberId : eligibleMembers) {
-            auto character = characterStore_.loadById(memberId);
-            if (!character) {
-                continue;
-            }
+            // Eligible members are all in players_; XP goes to their in-memory record
+            ZonePlayer& member = players_.find(memberId)->second;
+            auto& character = member.character;
             
-            std::uint32_t oldLevel = character->level;
-            std::uint64_t oldXp = character->xp;
+            std::uint32_t oldLevel = character.level;
+            std::uint64_t oldXp = character.xp;
             
-            req::shared::AddXp(*character, share, xpTable_, worldRules_);
+            req::shared::AddXp(character, share, xpTable_, worldRules_);
             
             // Update ZonePlayer state
-            auto memberIt = players_.find(memberId);
-            if (memberIt != players_.end()) {
-                memberIt->second.level = character->level;
-                memberIt->second.xp = character->xp;
-                memberIt->second.combatStatsDirty = true;
-            }
-            
-            characterStore_.saveCharacter(*character);
+            member.level = character.level;
+            member.xp = character.xp;
+            member.combatStatsDirty = true;
             
             req::shared::logInfo("zone", std::string{"[XP][Group] Member "} + std::to_string(memberId) +
-                " awarded " + std::to_string(share) + " XP, level=" + std::to_string(character->level) +
-                ", totalXp=" + std::to_string(character->xp));
+                " awarded " + std::to_string(share) + " XP, level=" + std::to_string(character.level) +
+                ", totalXp=" + std::to_string(character.xp));
             
-            if (character->level > oldLevel) {
+            if (character.level > oldLevel) {
                 req::shared::logInfo("zone", std::string{"[LEVELUP] Character "} +
                     std::to_string(memberId) + " leveled up: " +
-                    std::to_string(oldLevel) + " -> " + std::to_string(character->level));
+                    std::to_string(oldLevel) + " -> " + std::to_string(character.level));
             }
         }
     }
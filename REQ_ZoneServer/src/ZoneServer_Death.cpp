@@ -19,52 +19,47 @@ void ZoneServer::handlePlayerDeath(ZonePlayer& player) {
     req::shared::logInfo("zone", std::string{"[DEATH] ========== PLAYER DEATH BEGIN =========="});
     req::shared::logInfo("zone", std::string{"[DEATH] characterId="} + std::to_string(player.characterId));
     
-    // Load character from disk
-    auto character = characterStore_.loadById(player.characterId);
-    if (!character.has_value()) {
-        req::shared::logError("zone", std::string{"[DEATH] Cannot process death - character not found: characterId="} +
-            std::to_string(player.characterId));
-        return;
-    }
+    // XP loss works on the in-memory record (level/xp match the player's)
+    auto& character = player.character;
     
     // Store old values for logging
-    std::uint32_t oldLevel = character->level;
-    std::uint64_t oldXp = character->xp;
+    std::uint32_t oldLevel = character.level;
+    std::uint64_t oldXp = character.xp;
     
     // Apply XP loss based on WorldRules
     // Rule: No XP loss below level 6 (from GDD)
-    if (character->level >= 6) {
+    if (character.level >= 6) {
         float xpLossMultiplier = worldRules_.death.xpLossMultiplier;
         
         // Calculate XP loss
         // Get XP for current level and next level
-        std::int64_t xpCurrentLevel = req::shared::GetTotalXpForLevel(xpTable_, character->level);
-        std::int64_t xpNextLevel = req::shared::GetTotalXpForLevel(xpTable_, character->level + 1);
-        std::int64_t xpIntoLevel = character->xp - xpCurrentLevel;
+        std::int64_t xpCurrentLevel = req::shared::GetTotalXpForLevel(xpTable_, character.level);
+        std::int64_t xpNextLevel = req::shared::GetTotalXpForLevel(xpTable_, character.level + 1);
+        std::int64_t xpIntoLevel = character.xp - xpCurrentLevel;
         std::int64_t xpToLose = static_cast<std::int64_t>(xpIntoLevel * xpLossMultiplier);
         
         // Ensure we don't lose more XP than we have in this level
         xpToLose = std::min(xpToLose, xpIntoLevel);
         
         // Apply XP loss
-        character->xp -= xpToLose;
+        character.xp -= xpToLose;
         
         // Check if we need to de-level
-        while (character->level > 1 && character->xp < static_cast<std::uint64_t>(xpCurrentLevel)) {
-            --character->level;
-            xpCurrentLevel = req::shared::GetTotalXpForLevel(xpTable_, character->level);
+        while (character.level > 1 && character.xp < static_cast<std::uint64_t>(xpCurrentLevel)) {
+            --character.level;
+            xpCurrentLevel = req::shared::GetTotalXpForLevel(xpTable_, character.level);
             
             req::shared::logInfo("zone", std::string{"[DEATH] De-leveled: "} + 
-                std::to_string(character->level + 1) + " -> " + std::to_string(character->level));
+                std::to_string(character.level + 1) + " -> " + std::to_string(character.level));
         }
         
         req::shared::logInfo("zone", std::string{"[DEATH] XP loss applied: characterId="} +
             std::to_string(player.characterId) + ", level=" + std::to_string(oldLevel) +
-            " -> " + std::to_string(character->level) + ", xp=" + std::to_string(oldXp) +
-            " -> " + std::to_string(character->xp) + " (lost " + std::to_string(xpToLose) + ")");
+            " -> " + std::to_string(character.level) + ", xp=" + std::to_string(oldXp) +
+            " -> " + std::to_string(character.xp) + " (lost " + std::to_string(xpToLose) + ")");
     } else {
         req::shared::logInfo("zone", std::string{"[DEATH] No XP loss - level "} +
-            std::to_string(character->level) + " < 6 (safe from XP penalty)");
+            std::to_string(character.level) + " < 6 (safe from XP penalty)");
     }
     
     // Create corpse (if corpse runs enabled)
@@ -86,6 +81,7 @@ void ZoneServer::handlePlayerDeath(ZonePlayer& player) {
         corpse.expiresAtUnix = std::chrono::duration_cast<std::chrono::seconds>(expiryTime.time_since_epoch()).count();
         
         corpses_[corpse.corpseId] = corpse;
+        scheduleTimer(ZoneTimerKind::CorpseExpiry, corpse.corpseId, static_cast<double>(corpse.expiresAtUnix));
         
         req::shared::logInfo("zone", std::string{"[DEATH] Corpse created: corpseId="} +
             std::to_string(corpse.corpseId) + ", owner=" + std::to_string(corpse.ownerCharacterId) +
@@ -98,22 +94,19 @@ void ZoneServer::handlePlayerDeath(ZonePlayer& player) {
     // Mark player as dead
     player.isDead = true;
     player.hp = 0;
+    syncPlayerMotion(player);
     
     // Update ZonePlayer state from character
-    player.level = character->level;
-    player.xp = character->xp;
+    player.level = character.level;
+    player.xp = character.xp;
     player.combatStatsDirty = true;
     
     // Remove from all NPC hate tables (prevents ghost aggro)
     req::shared::logInfo("zone", "[DEATH] Removing character from all NPC hate tables");
     removeCharacterFromAllHateTables(player.characterId);
     
-    // Save character immediately
-    if (characterStore_.saveCharacter(*character)) {
-        req::shared::logInfo("zone", "[DEATH] Character saved successfully");
-    } else {
-        req::shared::logError("zone", "[DEATH] Failed to save character");
-    }
+    // Save right away through the normal dirty-tracked path
+    savePlayerPosition(player.characterId);
     
     req::shared::logInfo("zone", std::string{"[DEATH] ========== PLAYER DEATH END =========="});
 }
@@ -128,27 +121,22 @@ void ZoneServer::respawnPlayer(ZonePlayer& player) {
     req::shared::logInfo("zone", std::string{"[RESPAWN] ========== PLAYER RESPAWN BEGIN =========="});
     req::shared::logInfo("zone", std::string{"[RESPAWN] characterId="} + std::to_string(player.characterId));
     
-    // Load character to get bind point
-    auto character = characterStore_.loadById(player.characterId);
-    if (!character.has_value()) {
-        req::shared::logError("zone", std::string{"[RESPAWN] Cannot respawn - character not found: characterId="} +
-            std::to_string(player.characterId));
-        return;
-    }
+    // Bind point from the in-memory record
+    const auto& character = player.character;
     
     // Determine respawn location
     float respawnX, respawnY, respawnZ;
     bool useBindPoint = false;
     
     // Check if character has a valid bind point
-    if (character->bindWorldId >= 0 && character->bindZoneId >= 0) {
+    if (character.bindWorldId >= 0 && character.bindZoneId >= 0) {
         // Check if bind point is in this zone
-        if (character->bindWorldId == static_cast<std::int32_t>(worldId_) &&
-            character->bindZoneId == static_cast<std::int32_t>(zoneId_)) {
+        if (character.bindWorldId == static_cast<std::int32_t>(worldId_) &&
+            character.bindZoneId == static_cast<std::int32_t>(zoneId_)) {
             // Respawn at bind point
-            respawnX = character->bindX;
-            respawnY = character->bindY;
-            respawnZ = character->bindZ;
+            respawnX = character.bindX;
+            respawnY = character.bindY;
+            respawnZ = character.bindZ;
             useBindPoint = true;
             
             req::shared::logInfo("zone", std::string{"[RESPAWN] Using bind point in current zone: ("} +
@@ -157,7 +145,7 @@ void ZoneServer::respawnPlayer(ZonePlayer& player) {
         } else {
             // Bind point is in a different zone
             req::shared::logWarn("zone", std::string{"[RESPAWN] Bind point is in different zone (world="} +
-                std::to_string(character->bindWorldId) + ", zone=" + std::to_string(character->bindZoneId) +
+                std::to_string(character.bindWorldId) + ", zone=" + std::to_string(character.bindZoneId) +
                 ") - using current zone safe spawn (TODO: cross-zone respawn)");
             respawnX = zoneConfig_.safeX;
             respawnY = zoneConfig_.safeY;
@@ -185,6 +173,7 @@ void ZoneServer::respawnPlayer(ZonePlayer& player) {
     
     // Clear death flag
     player.isDead = false;
+    syncPlayerMotion(player);
     
     // Mark as dirty for save
     player.combatStatsDirty = true;
@@ -199,25 +188,15 @@ void ZoneServer::respawnPlayer(ZonePlayer& player) {
     req::shared::logInfo("zone", std::string{"[RESPAWN] ========== PLAYER RESPAWN END =========="});
 }
 
-void ZoneServer::processCorpseDecay() {
-    auto now = std::chrono::system_clock::now();
-    auto nowUnix = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
-    
-    // Find expired corpses
-    std::vector<std::uint64_t> expiredCorpses;
-    for (const auto& [corpseId, corpse] : corpses_) {
-        if (nowUnix >= corpse.expiresAtUnix) {
-            expiredCorpses.push_back(corpseId);
-        }
+void ZoneServer::expireCorpse(std::uint64_t corpseId, double currentTime) {
+    auto it = corpses_.find(corpseId);
+    if (it == corpses_.end() || currentTime < static_cast<double>(it->second.expiresAtUnix)) {
+        return;
     }
     
-    // Remove expired corpses
-    for (std::uint64_t corpseId : expiredCorpses) {
-        const auto& corpse = corpses_[corpseId];
-        req::shared::logInfo("zone", std::string{"[CORPSE] Decayed: corpseId="} +
-            std::to_string(corpseId) + ", owner=" + std::to_string(corpse.ownerCharacterId));
-        corpses_.erase(corpseId);
-    }
+    req::shared::logInfo("zone", std::string{"[CORPSE] Decayed: corpseId="} +
+        std::to_string(corpseId) + ", owner=" + std::to_string(it->second.ownerCharacterId));
+    corpses_.erase(it);
 }
 
 // Dev command implementations
@@ -232,32 +211,26 @@ void ZoneServer::devGiveXp(std::uint64_t characterId, std::int64_t amount) {
     
     ZonePlayer& player = playerIt->second;
     
-    // Load character
-    auto character = characterStore_.loadById(characterId);
-    if (!character.has_value()) {
-        req::shared::logError("zone", std::string{"[DEV] GiveXP failed - character not found: characterId="} +
-            std::to_string(characterId));
-        return;
-    }
+    auto& character = player.character;
     
-    std::uint32_t oldLevel = character->level;
-    std::uint64_t oldXp = character->xp;
+    std::uint32_t oldLevel = character.level;
+    std::uint64_t oldXp = character.xp;
     
     // Use AddXp helper to handle level-ups
-    req::shared::AddXp(*character, amount, xpTable_, worldRules_);
+    req::shared::AddXp(character, amount, xpTable_, worldRules_);
     
     // Update ZonePlayer state
-    player.level = character->level;
-    player.xp = character->xp;
+    player.level = character.level;
+    player.xp = character.xp;
     player.combatStatsDirty = true;
     
-    // Save character
-    characterStore_.saveCharacter(*character);
+    // Written by the next save (autosave / zone exit)
+    player.isDirty = true;
     
     req::shared::logInfo("zone", std::string{"[DEV] GiveXP: characterId="} + std::to_string(characterId) +
         ", amount=" + std::to_string(amount) + ", level=" + std::to_string(oldLevel) +
-        " -> " + std::to_string(character->level) + ", xp=" + std::to_string(oldXp) +
-        " -> " + std::to_string(character->xp));
+        " -> " + std::to_string(character.level) + ", xp=" + std::to_string(oldXp) +
+        " -> " + std::to_string(character.xp));
 }
 
 void ZoneServer::devSetLevel(std::uint64_t characterId, std::uint32_t level) {
@@ -270,36 +243,30 @@ void ZoneServer::devSetLevel(std::uint64_t characterId, std::uint32_t level) {
     
     ZonePlayer& player = playerIt->second;
     
-    // Load character
-    auto character = characterStore_.loadById(characterId);
-    if (!character.has_value()) {
-        req::shared::logError("zone", std::string{"[DEV] SetLevel failed - character not found: characterId="} +
-            std::to_string(characterId));
-        return;
-    }
+    auto& character = player.character;
     
     // Clamp level to table range
     const int maxLevel = xpTable_.entries.empty() ? 50 : xpTable_.entries.back().level;
     level = std::max(1u, std::min(level, static_cast<std::uint32_t>(maxLevel)));
     
-    std::uint32_t oldLevel = character->level;
-    std::uint64_t oldXp = character->xp;
+    std::uint32_t oldLevel = character.level;
+    std::uint64_t oldXp = character.xp;
     
     // Set level and XP
-    character->level = level;
-    character->xp = req::shared::GetTotalXpForLevel(xpTable_, level);
+    character.level = level;
+    character.xp = req::shared::GetTotalXpForLevel(xpTable_, level);
     
     // Update ZonePlayer state
-    player.level = character->level;
-    player.xp = character->xp;
+    player.level = character.level;
+    player.xp = character.xp;
     player.combatStatsDirty = true;
     
-    // Save character
-    characterStore_.saveCharacter(*character);
+    // Written by the next save (autosave / zone exit)
+    player.isDirty = true;
     
     req::shared::logInfo("zone", std::string{"[DEV] SetLevel: characterId="} + std::to_string(characterId) +
         ", level=" + std::to_string(oldLevel) + " -> " + std::to_string(level) +
-        ", xp=" + std::to_string(oldXp) + " -> " + std::to_string(character->xp));
+        ", xp=" + std::to_string(oldXp) + " -> " + std::to_string(character.xp));
 }
 
 void ZoneServer::devSuicide(std::uint64_t characterId) {
@@ -445,6 +412,7 @@ void ZoneServer::adminSpawnNpc(std::uint64_t gmCharacterId, std::int32_t npcId)
 
     // Add to zone
     npcs_[npc.npcId] = npc;
+    npcGrid_.update(npc.npcId, npc.posX, npc.posY);
 
     req::shared::logInfo("zone", std::string{"[ADMIN] Spawned NPC: instanceId="} +
         std::to_string(npc.npcId) + ", templateId=" + std::to_string(npc.templateId) +
@@ -475,11 +443,14 @@ void ZoneServer::devRespawnAll(std::uint64_t characterId) {
         // Set spawn state to WaitingToSpawn with immediate timer
         record.state = SpawnState::WaitingToSpawn;
         record.next_spawn_time = currentTime;  // Spawn immediately on next tick
+        noteSpawnDue(record);
         
         // Remove current NPC if alive
         if (record.current_entity_id != 0) {
             auto npcIt = npcs_.find(record.current_entity_id);
             if (npcIt != npcs_.end()) {
+                npcGrid_.remove(npcIt->first);
+                unindexHate(npcIt->second);
                 npcs_.erase(npcIt);
             }
             record.current_entity_id = 0;
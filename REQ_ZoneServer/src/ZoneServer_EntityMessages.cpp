@@ -12,39 +12,26 @@ namespace req::zone {
 // Entity Spawn Messages
 // ============================================================================
 
-void ZoneServer::sendEntitySpawn(ConnectionPtr connection, std::uint64_t entityId) {
-    if (!connection) {
-        req::shared::logWarn("zone", "[ENTITY_SPAWN] Null connection, cannot send spawn message");
-        return;
-    }
-    
+bool ZoneServer::buildEntitySpawnData(std::uint64_t entityId, req::shared::protocol::EntitySpawnData& outData) const {
     // Check if entity is a player
     auto playerIt = players_.find(entityId);
     if (playerIt != players_.end()) {
         const ZonePlayer& player = playerIt->second;
         
-        // Build EntitySpawn message for player
-        req::shared::protocol::EntitySpawnData spawnData;
-        spawnData.entityId = player.characterId;
-        spawnData.entityType = 0;  // 0 = Player
-        spawnData.templateId = 0;  // TODO: Use race ID from character
-        spawnData.name = "Player_" + std::to_string(player.characterId);  // TODO: Load actual name from character
-        spawnData.posX = player.posX;
-        spawnData.posY = player.posY;
-        spawnData.posZ = player.posZ;
-        spawnData.heading = player.yawDegrees;
-        spawnData.level = player.level;
-        spawnData.hp = player.hp;
-        spawnData.maxHp = player.maxHp;
-        spawnData.visualId = "0";  // TODO: Load visual ID from character/race
-        
-        std::string payload = req::shared::protocol::buildEntitySpawnPayload(spawnData);
-        req::shared::net::Connection::ByteArray payloadBytes(payload.begin(), payload.end());
-        connection->send(req::shared::MessageType::EntitySpawn, payloadBytes);
-        
-        req::shared::logInfo("zone", std::string{"[ENTITY_SPAWN] Sent player spawn: entityId="} +
-            std::to_string(entityId) + ", name=" + spawnData.name);
-        return;
+        // Build EntitySpawn data for player
+        outData.entityId = player.characterId;
+        outData.entityType = 0;  // 0 = Player
+        outData.templateId = 0;  // TODO: Use race ID from character
+        outData.name = "Player_" + std::to_string(player.characterId);  // TODO: Load actual name from character
+        outData.posX = player.posX;
+        outData.posY = player.posY;
+        outData.posZ = player.posZ;
+        outData.heading = player.yawDegrees;
+        outData.level = player.level;
+        outData.hp = player.hp;
+        outData.maxHp = player.maxHp;
+        outData.visualId = "0";  // TODO: Load visual ID from character/race
+        return true;
     }
     
     // Check if entity is an NPC
@@ -54,41 +41,68 @@ void ZoneServer::sendEntitySpawn(ConnectionPtr connection, std::uint64_t entityI
         
         // Get NPC template to retrieve visualId
         const NpcTemplateData* tmpl = npcDataRepository_.GetTemplate(npc.templateId);
-        std::string visualId = tmpl ? tmpl->visualId : "0";
-        
-        // Build EntitySpawn message for NPC
-        req::shared::protocol::EntitySpawnData spawnData;
-        spawnData.entityId = npc.npcId;
-        spawnData.entityType = 1;  // 1 = NPC
-        spawnData.templateId = npc.templateId;
-        spawnData.name = npc.name;
-        spawnData.posX = npc.posX;
-        spawnData.posY = npc.posY;
-        spawnData.posZ = npc.posZ;
-        spawnData.heading = npc.facingDegrees;
-        spawnData.level = npc.level;
-        spawnData.hp = npc.currentHp;
-        spawnData.maxHp = npc.maxHp;
-        spawnData.visualId = visualId;
-        
-        std::string payload = req::shared::protocol::buildEntitySpawnPayload(spawnData);
-        req::shared::net::Connection::ByteArray payloadBytes(payload.begin(), payload.end());
-        connection->send(req::shared::MessageType::EntitySpawn, payloadBytes);
         
-        req::shared::logInfo("zone", std::string{"[ENTITY_SPAWN] Sent NPC spawn: entityId="} +
-            std::to_string(entityId) + ", name=\"" + npc.name + "\"");
+        // Build EntitySpawn data for NPC
+        outData.entityId = npc.npcId;
+        outData.entityType = 1;  // 1 = NPC
+        outData.templateId = npc.templateId;
+        outData.name = npc.name;
+        outData.posX = npc.posX;
+        outData.posY = npc.posY;
+        outData.posZ = npc.posZ;
+        outData.heading = npc.facingDegrees;
+        outData.level = npc.level;
+        outData.hp = npc.currentHp;
+        outData.maxHp = npc.maxHp;
+        outData.visualId = tmpl ? tmpl->visualId : "0";
+        return true;
+    }
+    
+    return false;
+}
+
+void ZoneServer::sendEntitySpawn(ConnectionPtr connection, std::uint64_t entityId) {
+    if (!connection) {
+        req::shared::logWarn("zone", "[ENTITY_SPAWN] Null connection, cannot send spawn message");
         return;
     }
     
-    req::shared::logWarn("zone", std::string{"[ENTITY_SPAWN] Entity not found: entityId="} +
-        std::to_string(entityId));
+    req::shared::protocol::EntitySpawnData spawnData;
+    if (!buildEntitySpawnData(entityId, spawnData)) {
+        req::shared::logWarn("zone", std::string{"[ENTITY_SPAWN] Entity not found: entityId="} +
+            std::to_string(entityId));
+        return;
+    }
+    
+    std::string payload = req::shared::protocol::buildEntitySpawnPayload(spawnData);
+    connection->send(req::shared::net::Connection::makeFrame(req::shared::MessageType::EntitySpawn, payload));
+    
+    if (spawnData.entityType == 0) {
+        req::shared::logInfo("zone", std::string{"[ENTITY_SPAWN] Sent player spawn: entityId="} +
+            std::to_string(entityId) + ", name=" + spawnData.name);
+    } else {
+        req::shared::logInfo("zone", std::string{"[ENTITY_SPAWN] Sent NPC spawn: entityId="} +
+            std::to_string(entityId) + ", name=\"" + spawnData.name + "\"");
+    }
 }
 
 void ZoneServer::broadcastEntitySpawn(std::uint64_t entityId) {
     req::shared::logInfo("zone", std::string{"[ENTITY_SPAWN] Broadcasting spawn: entityId="} +
         std::to_string(entityId));
     
+    req::shared::protocol::EntitySpawnData spawnData;
+    if (!buildEntitySpawnData(entityId, spawnData)) {
+        req::shared::logWarn("zone", std::string{"[ENTITY_SPAWN] Entity not found: entityId="} +
+            std::to_string(entityId));
+        return;
+    }
+    
+    // Encode once; every recipient shares the same frame
+    auto frame = req::shared::net::Connection::makeFrame(req::shared::MessageType::EntitySpawn,
+        req::shared::protocol::buildEntitySpawnPayload(spawnData));
+    
     // Send to all connected players
+    int sentCount = 0;
     for (auto& [characterId, player] : players_) {
         if (!player.connection || !player.isInitialized) {
             continue;
@@ -103,8 +117,12 @@ void ZoneServer::broadcastEntitySpawn(std::uint64_t entityId) {
         player.knownEntities.insert(entityId);
         
         // Send spawn message
-        sendEntitySpawn(player.connection, entityId);
+        player.connection->send(frame);
+        sentCount++;
     }
+    
+    req::shared::logInfo("zone", std::string{"[ENTITY_SPAWN] Spawn broadcast: entityId="} +
+        std::to_string(entityId) + ", name=\"" + spawnData.name + "\", recipients=" + std::to_string(sentCount));
 }
 
 void ZoneServer::sendAllKnownEntities(ConnectionPtr connection, std::uint64_t characterId) {
@@ -165,9 +183,9 @@ void ZoneServer::sendEntityUpdate(ConnectionPtr connection, std::uint64_t entity
         updateData.hp = npc.currentHp;
         updateData.state = static_cast<std::uint8_t>(npc.aiState);
         
-        std::string payload = req::shared::protocol::buildEntityUpdatePayload(updateData);
-        req::shared::net::Connection::ByteArray payloadBytes(payload.begin(), payload.end());
-        connection->send(req::shared::MessageType::EntityUpdate, payloadBytes);
+        std::string payload = req::shared::protocol::buildEntityUpdatePayload(updateData, getWireFormat(connection),
+            getQuantization(connection));
+        sendUnreliable(connection, req::shared::net::Connection::makeFrame(req::shared::MessageType::EntityUpdate, payload));
     }
 }
 
@@ -219,6 +237,9 @@ void ZoneServer::broadcastEntityDespawn(std::uint64_t entityId, std::uint32_t re
     req::shared::logInfo("zone", std::string{"[ENTITY_DESPAWN] Broadcasting despawn: entityId="} +
         std::to_string(entityId) + ", reason=" + std::to_string(reason));
     
+    // Encoded lazily on first recipient, then shared
+    req::shared::net::Connection::SharedFrame frame;
+    
     // Send to all connected players who know about this entity
     for (auto& [characterId, player] : players_) {
         if (!player.connection || !player.isInitialized) {
@@ -231,7 +252,14 @@ void ZoneServer::broadcastEntityDespawn(std::uint64_t entityId, std::uint32_t re
             player.knownEntities.erase(entityId);
             
             // Send despawn message
-            sendEntityDespawn(player.connection, entityId, reason);
+            if (!frame) {
+                req::shared::protocol::EntityDespawnData despawnData;
+                despawnData.entityId = entityId;
+                despawnData.reason = reason;
+                frame = req::shared::net::Connection::makeFrame(req::shared::MessageType::EntityDespawn,
+                    req::shared::protocol::buildEntityDespawnPayload(despawnData));
+            }
+            player.connection->send(frame);
         }
     }
 }
@@ -170,14 +170,10 @@ void ZoneServer::disbandGroup(std::uint64_t groupId) {
 void ZoneServer::handleGroupInvite(std::uint64_t inviterCharId, const std::string& targetName) {
     // Find target player by name in this zone
     ZonePlayer* targetPlayer = nullptr;
-    for (auto& [charId, player] : players_) {
-        if (player.isInitialized) {
-            // Load character to get name
-            auto character = characterStore_.loadById(charId);
-            if (character && character->name == targetName) {
-                targetPlayer = &player;
-                break;
-            }
+    if (auto targetId = findCharacterIdByName(targetName)) {
+        auto targetIt = players_.find(*targetId);
+        if (targetIt != players_.end() && targetIt->second.isInitialized) {
+            targetPlayer = &targetIt->second;
         }
     }
     
@@ -0,0 +1,126 @@
+#include "../include/req/zone/ZoneServer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../REQ_Shared/include/req/shared/Logger.h"
+#include "../../REQ_Shared/include/req/shared/ProtocolSchemas.h"
+
+namespace req::zone {
+
+namespace {
+    // RFC 6298 gains for the smoothed RTT and its mean deviation
+    constexpr float RTT_GAIN = 1.0f / 8.0f;
+    constexpr float RTT_VARIANCE_GAIN = 1.0f / 4.0f;
+    
+    // Clock offset is only refined from samples whose RTT is close to the
+    // smoothed value; a delayed Pong skews the symmetric-path assumption
+    constexpr float OFFSET_GAIN = 1.0f / 8.0f;
+    constexpr float OFFSET_RTT_TOLERANCE = 2.0f;  // x rttVariance above smoothedRtt
+}
+
+std::uint64_t ZoneServer::serverTimeMs() const {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - serverClockStart_).count());
+}
+
+void ZoneServer::sendLatencyProbes() {
+    if (zoneConfig_.pingIntervalSec <= 0.0f) {
+        return;
+    }
+    
+    const std::uint64_t now = serverTimeMs();
+    const auto intervalMs = static_cast<std::uint64_t>(zoneConfig_.pingIntervalSec * 1000.0f);
+    
+    for (auto& [characterId, player] : players_) {
+        if (!player.isInitialized || !player.connection || player.connection->isClosed()) {
+            continue;
+        }
+        auto& latency = player.latency;
+        if (latency.lastPingId != 0 && now - latency.lastPingSentMs < intervalMs) {
+            continue;
+        }
+        
+        req::shared::protocol::ZonePingData ping;
+        ping.pingId = ++latency.lastPingId;
+        ping.serverTimeMs = now;
+        latency.lastPingSentMs = now;
+        
+        auto payload = req::shared::protocol::buildZonePingPayload(ping);
+        player.connection->send(req::shared::net::Connection::makeFrame(req::shared::MessageType::Ping, payload));
+    }
+}
+
+void ZoneServer::handlePong(const ConnectionPtr& connection, std::string_view payload, std::uint64_t receivedAtMs) {
+    req::shared::protocol::ZonePongData pong;
+    if (!req::shared::protocol::parseZonePongPayload(payload, pong)) {
+        return;
+    }
+    
+    auto connIt = connectionToCharacterId_.find(connection);
+    if (connIt == connectionToCharacterId_.end()) {
+        return;  // Not authenticated yet; nothing was pinged
+    }
+    auto playerIt = players_.find(connIt->second);
+    if (playerIt == players_.end()) {
+        return;
+    }
+    ZonePlayer& player = playerIt->second;
+    auto& latency = player.latency;
+    
+    // Arrival time, not handling time: a queued Pong may wait for the next tick
+    const std::uint64_t now = receivedAtMs;
+    if (pong.pingId == 0 || pong.pingId > latency.lastPingId || pong.serverTimeMs > now) {
+        req::shared::logWarn("zone", std::string{"[LATENCY] Ignoring Pong with unknown ping: characterId="} +
+            std::to_string(player.characterId) + ", pingId=" + std::to_string(pong.pingId));
+        return;
+    }
+    
+    const float rttMs = static_cast<float>(now - pong.serverTimeMs);
+    // Client clock at the midpoint of the round trip vs. server clock at the same instant
+    const std::int64_t offsetSample = static_cast<std::int64_t>(pong.serverTimeMs) +
+        static_cast<std::int64_t>(std::llround(rttMs / 2.0f)) - static_cast<std::int64_t>(pong.clientTimeMs);
+    
+    if (latency.samples == 0) {
+        latency.smoothedRttMs = rttMs;
+        latency.rttVarianceMs = rttMs / 2.0f;
+        latency.clockOffsetMs = offsetSample;
+    } else {
+        bool offsetUsable = rttMs <= latency.smoothedRttMs + OFFSET_RTT_TOLERANCE * latency.rttVarianceMs;
+        latency.rttVarianceMs += RTT_VARIANCE_GAIN * (std::abs(latency.smoothedRttMs - rttMs) - latency.rttVarianceMs);
+        latency.smoothedRttMs += RTT_GAIN * (rttMs - latency.smoothedRttMs);
+        if (offsetUsable) {
+            latency.clockOffsetMs += static_cast<std::int64_t>(
+                std::llround(OFFSET_GAIN * static_cast<float>(offsetSample - latency.clockOffsetMs)));
+        }
+    }
+    latency.lastRttMs = rttMs;
+    ++latency.samples;
+    
+    netMetrics_->recordRtt(std::chrono::microseconds(static_cast<std::int64_t>(rttMs * 1000.0f)));
+    
+    if (latency.samples == 1 || latency.samples % 30 == 0) {
+        req::shared::logInfo("zone", std::string{"[LATENCY] characterId="} + std::to_string(player.characterId) +
+            ", rtt=" + std::to_string(rttMs) + "ms, srtt=" + std::to_string(latency.smoothedRttMs) +
+            "ms, rttvar=" + std::to_string(latency.rttVarianceMs) +
+            "ms, clockOffset=" + std::to_string(latency.clockOffsetMs) + "ms, samples=" + std::to_string(latency.samples));
+    }
+}
+
+std::optional<float> ZoneServer::getPlayerRttMs(std::uint64_t characterId) const {
+    auto it = players_.find(characterId);
+    if (it == players_.end() || !it->second.latency.hasEstimate()) {
+        return std::nullopt;
+    }
+    return it->second.latency.smoothedRttMs;
+}
+
+std::optional<std::uint64_t> ZoneServer::clientTimeToServerTimeMs(const ZonePlayer& player, std::uint64_t clientTimeMs) const {
+    if (!player.latency.hasEstimate()) {
+        return std::nullopt;
+    }
+    std::int64_t serverTime = static_cast<std::int64_t>(clientTimeMs) + player.latency.clockOffsetMs;
+    return static_cast<std::uint64_t>(std::max<std::int64_t>(serverTime, 0));
+}
+
+} // namespace req::zone
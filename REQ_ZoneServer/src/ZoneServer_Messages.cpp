@@ -13,8 +13,9 @@
 namespace req::zone {
 
 void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
-                               const req::shared::net::Connection::ByteArray& payload,
-                               ConnectionPtr connection) {
+                               std::string_view payload,
+                               ConnectionPtr connection,
+                               std::uint64_t receivedAtMs) {
     // Log incoming message header details
     req::shared::logInfo("zone", std::string{"[RECV] Message header: type="} + 
         std::to_string(static_cast<int>(header.type)) + 
@@ -28,7 +29,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
             std::to_string(header.protocolVersion) + ", server=" + std::to_string(req::shared::CurrentProtocolVersion));
     }
 
-    std::string body(payload.begin(), payload.end());
+    std::string_view body = payload;
 
     switch (header.type) {
     case req::shared::MessageType::ZoneAuthRequest: {
@@ -36,29 +37,31 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
          * ZoneAuthRequest Handler
          * 
          * Protocol Schema (from ProtocolSchemas.h):
-         *   Payload format: handoffToken|characterId
+         *   Payload format: handoffToken|characterId[|capabilities]
          *   
          *   Fields:
          *     - handoffToken: decimal handoff token from WorldAuthResponse/EnterWorldResponse
          *     - characterId: decimal character ID to enter zone with
+         *     - capabilities: optional ZoneCapability bitmask (binary hot messages, etc.)
          *   
          *   Example: "987654321|42"
          * 
          * Response:
          *   ZoneAuthResponse with either:
-         *     - Success: "OK|<welcomeMessage>"
+         *     - Success: "OK|<welcomeMessage>[|<negotiatedCapabilities>]"
          *     - Error: "ERR|<errorCode>|<errorMessage>"
          */
         
         req::shared::logInfo("zone", std::string{"[ZONEAUTH] Received ZoneAuthRequest, payloadSize="} + 
             std::to_string(header.payloadSize));
-        req::shared::logInfo("zone", std::string{"[ZONEAUTH] Raw payload: '"} + body + "'");
+        req::shared::logInfo("zone", std::string{"[ZONEAUTH] Raw payload: '"} + std::string(body) + "'");
 
         req::shared::HandoffToken handoffToken = 0;
         req::shared::PlayerId characterId = 0;
+        std::uint32_t requestedCapabilities = 0;
         
         // Parse the payload
-        if (!req::shared::protocol::parseZoneAuthRequestPayload(body, handoffToken, characterId)) {
+        if (!req::shared::protocol::parseZoneAuthRequestPayload(body, handoffToken, characterId, requestedCapabilities)) {
             req::shared::logError("zone", "[ZONEAUTH] PARSE FAILED - sending error response");
             
             auto errPayload = req::shared::protocol::buildZoneAuthResponseErrorPayload(
@@ -77,6 +80,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         req::shared::logInfo("zone", std::string{"[ZONEAUTH] Parsed successfully:"});
         req::shared::logInfo("zone", std::string{"[ZONEAUTH]   handoffToken="} + std::to_string(handoffToken));
         req::shared::logInfo("zone", std::string{"[ZONEAUTH]   characterId="} + std::to_string(characterId));
+        req::shared::logInfo("zone", std::string{"[ZONEAUTH]   capabilities="} + std::to_string(requestedCapabilities));
         req::shared::logInfo("zone", std::string{"[ZONEAUTH]   zone=\""} + zoneName_ + "\" (id=" + std::to_string(zoneId_) + ")");
 
         // TODO: Validate handoffToken with world server or shared handoff service
@@ -106,11 +110,12 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         
         req::shared::logInfo("zone", "[ZONEAUTH] Handoff token validation PASSED (stub)");
         
-        // Load character data from disk
+        // Load character data; this is the only load for the player's stay
+        // in the zone (ZonePlayer::character is authoritative from here on)
         req::shared::logInfo("zone", std::string{"[ZONEAUTH] Loading character data: characterId="} +
             std::to_string(characterId));
         
-        auto character = characterStore_.loadById(characterId);
+        auto character = loadCharacter(characterId);
         if (!character.has_value()) {
             req::shared::logError("zone", std::string{"[ZONEAUTH] CHARACTER NOT FOUND: characterId="} +
                 std::to_string(characterId) + " - sending error response");
@@ -137,12 +142,38 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
             req::shared::logWarn("zone", std::string{"[ZONEAUTH] Character already in zone: characterId="} +
                 std::to_string(characterId) + ", removing old entry");
             removePlayer(characterId);
+            
+            // The old entry's record was newer than what was loaded above;
+            // removePlayer just queued it
+            if (auto latest = loadCharacter(characterId)) {
+                character = std::move(latest);
+            }
         }
         
         ZonePlayer player;
         player.characterId = characterId;
         player.accountId = character->accountId;
         player.connection = connection;
+        std::uint32_t offeredCapabilities = req::shared::protocol::SupportedZoneCapabilities;
+        if (!datagramChannel_) {
+            offeredCapabilities &= ~req::shared::protocol::ZoneCapability::UdpChannel;
+        }
+        if (!zoneConfig_.deltaSnapshots) {
+            offeredCapabilities &= ~req::shared::protocol::ZoneCapability::DeltaSnapshots;
+        }
+        if (!zoneConfig_.quantizeState) {
+            offeredCapabilities &= ~req::shared::protocol::ZoneCapability::QuantizedState;
+        }
+        player.capabilities = requestedCapabilities & offeredCapabilities;
+        if (!(player.capabilities & req::shared::protocol::ZoneCapability::BinaryHotMessages)) {
+            // Deltas and quantized state only exist in the binary encoding
+            player.capabilities &= ~(req::shared::protocol::ZoneCapability::DeltaSnapshots |
+                req::shared::protocol::ZoneCapability::QuantizedState);
+        }
+        if (player.capabilities & req::shared::protocol::ZoneCapability::UdpChannel) {
+            // Datagrams for this session must carry the handoff token it authenticated with
+            datagramChannel_->addSession(characterId, handoffToken);
+        }
         
         // Cache admin flag from account
         auto accountOpt = accountStore_.loadById(character->accountId);
@@ -154,6 +185,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         
         // Determine spawn position using character data
         spawnPlayer(*character, player);
+        player.character = *character;
         
         // Initialize combat state from character
         player.level = character->level;
@@ -193,6 +225,8 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         // Insert into players map
         players_[characterId] = player;
         connectionToCharacterId_[connection] = characterId;
+        indexCharacterName(player);
+        syncPlayerMotion(players_[characterId]);
         
         req::shared::logInfo("zone", std::string{"[ZonePlayer created] characterId="} + 
             std::to_string(characterId) + ", accountId=" + std::to_string(character->accountId) +
@@ -206,7 +240,8 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         std::string welcomeMsg = std::string("Welcome to ") + zoneName_ + 
             " (zone " + std::to_string(zoneId_) + " on world " + std::to_string(worldId_) + ")";
         
-        auto respPayload = req::shared::protocol::buildZoneAuthResponseOkPayload(welcomeMsg);
+        auto respPayload = req::shared::protocol::buildZoneAuthResponseOkPayload(welcomeMsg, player.capabilities,
+            datagramChannel_ ? datagramChannel_->localPort() : 0, &zoneConfig_.quantization);
         req::shared::net::Connection::ByteArray respBytes(respPayload.begin(), respPayload.end());
         
         req::shared::logInfo("zone", std::string{"[ZONEAUTH] Sending SUCCESS response:"});
@@ -216,15 +251,29 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
 
         req::shared::logInfo("zone", std::string{"[ZONEAUTH]   payloadSize="} + std::to_string(respPayload.size()));
         req::shared::logInfo("zone", std::string{"[ZONEAUTH]   payload='"} + respPayload + "'");
+        req::shared::logInfo("zone", std::string{"[ZONEAUTH]   negotiatedCapabilities="} + std::to_string(player.capabilities));
+
+        // Hold the response and the entity burst below for a single write
+        bool wasCorked = connection->isCorked();
+        connection->setCorked(true);
 
         connection->send(req::shared::MessageType::ZoneAuthResponse, respBytes);
 
+        // Everything after the response may be bundled
+        if (player.capabilities & req::shared::protocol::ZoneCapability::MessageBundles) {
+            connection->setBundlingEnabled(true);
+        }
+
         req::shared::logInfo("zone", std::string{"[ZONEAUTH] COMPLETE: characterId="} + 
             std::to_string(characterId) + " successfully entered zone \"" + zoneName_ + "\"");
         
         // Send snapshot of all existing entities (players + NPCs) to newly joined player
         sendAllKnownEntities(connection, characterId);
         
+        if (!wasCorked) {
+            connection->setCorked(false);
+        }
+        
         // Broadcast this player's spawn to all other players
         broadcastEntitySpawn(characterId);
         
@@ -232,26 +281,27 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
     }
     
     case req::shared::MessageType::MovementIntent: {
-        // Log raw payload for debugging
-        req::shared::logInfo("zone", std::string{"[Movement] Raw payload: '"} + body + "'");
+        // Log raw payload for debugging (binary payloads are not printable)
+        if (req::shared::protocol::isBinaryPayload(body)) {
+            req::shared::logInfo("zone", std::string{"[Movement] Raw payload: <binary, "} + std::to_string(body.size()) + " bytes>");
+        } else {
+            req::shared::logInfo("zone", std::string{"[Movement] Raw payload: '"} + std::string(body) + "'");
+        }
         
         req::shared::protocol::MovementIntentData intent;
         
         if (!req::shared::protocol::parseMovementIntentPayload(body, intent)) {
             // Parse failed - log with rate limiting to prevent spam
-            static std::uint64_t parseErrorCount = 0;
-            static std::chrono::steady_clock::time_point lastLogTime = std::chrono::steady_clock::now();
-            
-            parseErrorCount++;
+            movementParseErrors_++;
             
             auto now = std::chrono::steady_clock::now();
-            auto timeSinceLastLog = std::chrono::duration_cast<std::chrono::seconds>(now - lastLogTime).count();
+            auto timeSinceLastLog = std::chrono::duration_cast<std::chrono::seconds>(now - lastMovementParseErrorLog_).count();
             
             if (timeSinceLastLog >= 5) {  // Log summary every 5 seconds
                 req::shared::logError("zone", std::string{"Failed to parse MovementIntent payload (errors in last 5s: "} + 
-                    std::to_string(parseErrorCount) + "), last payload: '" + body + "'");
-                parseErrorCount = 0;
-                lastLogTime = now;
+                    std::to_string(movementParseErrors_) + "), last payload: '" + std::string(body) + "'");
+                movementParseErrors_ = 0;
+                lastMovementParseErrorLog_ = now;
             }
             
             // IMPORTANT: Do NOT use 'intent' beyond this point - it contains garbage
@@ -298,6 +348,11 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
             return;
         }
         
+        // Snapshot ack (DeltaSnapshots); taken even from a stale intent, acks only move forward
+        if (intent.ackSnapshotId > player.snapshotBaselines.ackedSnapshotId && intent.ackSnapshotId <= snapshotCounter_) {
+            player.snapshotBaselines.ackedSnapshotId = intent.ackSnapshotId;
+        }
+        
         // Validate sequence number (ignore old/duplicate packets)
         if (intent.sequenceNumber <= player.lastSequenceNumber) {
             // This is normal for out-of-order packets, don't log at warn level
@@ -308,6 +363,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         player.inputX = std::clamp(intent.inputX, -1.0f, 1.0f);
         player.inputY = std::clamp(intent.inputY, -1.0f, 1.0f);
         player.isJumpPressed = intent.isJumpPressed;
+        syncPlayerMotion(player);
         
         // Normalize yaw to 0-360
         player.yawDegrees = intent.facingYawDegrees;
@@ -316,6 +372,11 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         
         player.lastSequenceNumber = intent.sequenceNumber;
         
+        // One-way input delay once the client clock is mapped (see ZoneServer_Latency.cpp)
+        if (auto sentAt = clientTimeToServerTimeMs(player, intent.clientTimeMs)) {
+            player.latency.lastInputDelayMs = static_cast<std::int64_t>(serverTimeMs()) - static_cast<std::int64_t>(*sentAt);
+        }
+        
         // Log that input was stored
         req::shared::logInfo("zone", std::string{"[Movement] Stored input for charId="} +
             std::to_string(intent.characterId) + ": input=(" + 
@@ -363,7 +424,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
                 result.message = "Invalid attacker";
                 
                 try {
-                    std::string resultPayload = req::shared::protocol::buildAttackResultPayload(result);
+                    std::string resultPayload = req::shared::protocol::buildAttackResultPayload(result, getWireFormat(connection));
                     req::shared::net::Connection::ByteArray resultBytes(resultPayload.begin(), resultPayload.end());
                     connection->send(req::shared::MessageType::AttackResult, resultBytes);
                 } catch (const std::exception& e) {
@@ -398,7 +459,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
                 result.resultCode = 2; // Not owner
                 result.message = "Not your character";
                 
-                std::string resultPayload = req::shared::protocol::buildAttackResultPayload(result);
+                std::string resultPayload = req::shared::protocol::buildAttackResultPayload(result, getWireFormat(connection));
                 req::shared::net::Connection::ByteArray resultBytes(resultPayload.begin(), resultPayload.end());
                 connection->send(req::shared::MessageType::AttackResult, resultBytes);
             } catch (const std::exception& e) {
@@ -423,7 +484,7 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
                 result.resultCode = 1; // Invalid target
                 result.message = "Invalid target";
                 
-                std::string resultPayload = req::shared::protocol::buildAttackResultPayload(result);
+                std::string resultPayload = req::shared::protocol::buildAttackResultPayload(result, getWireFormat(connection));
                 req::shared::net::Connection::ByteArray resultBytes(resultPayload.begin(), resultPayload.end());
                 connection->send(req::shared::MessageType::AttackResult, resultBytes);
             } catch (const std::exception& e) {
@@ -563,6 +624,11 @@ void ZoneServer::handleMessage(const req::shared::MessageHeader& header,
         break;
     }
     
+    case req::shared::MessageType::Pong: {
+        handlePong(connection, body, receivedAtMs != 0 ? receivedAtMs : serverTimeMs());
+        break;
+    }
+    
     default:
         req::shared::logWarn("zone", std::string{"Unsupported message type: "} + 
             std::to_string(static_cast<int>(header.type)));
@@ -1,6 +1,9 @@
 #include "../include/req/zone/ZoneServer.h"
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
 
 #include "../../REQ_Shared/include/req/shared/Logger.h"
 #include "../../REQ_Shared/include/req/shared/MessageHeader.h"
@@ -12,7 +15,11 @@ namespace req::zone {
 
 void ZoneServer::startAccept() {
     using boost::asio::ip::tcp;
-    auto socket = std::make_shared<tcp::socket>(ioContext_);
+    // With I/O threads (or a shared host pool) each socket gets its own strand so
+    // its reads, writes and callbacks never run concurrently; single-threaded mode needs none
+    auto socket = concurrentIo()
+        ? std::make_shared<tcp::socket>(boost::asio::make_strand(ioContext_))
+        : std::make_shared<tcp::socket>(ioContext_);
     acceptor_.async_accept(*socket, [this, socket](const boost::system::error_code& ec) {
         if (!ec) {
             handleNewConnection(std::move(*socket));
@@ -26,22 +33,54 @@ void ZoneServer::startAccept() {
 void ZoneServer::handleNewConnection(Tcp::socket socket) {
     auto connection = std::make_shared<req::shared::net::Connection>(std::move(socket));
     connections_.push_back(connection);
-
-    connection->setMessageHandler([this, connection](const req::shared::MessageHeader& header,
-                                         const req::shared::net::Connection::ByteArray& payload,
-                                         std::shared_ptr<req::shared::net::Connection> conn) {
-        handleMessage(header, payload, conn);
-    });
     
-    connection->setDisconnectHandler([this](std::shared_ptr<req::shared::net::Connection> conn) {
-        onConnectionClosed(conn);
-    });
+    req::shared::net::Connection::QueueLimits limits;
+    limits.maxPendingBytes = zoneConfig_.maxOutboundQueueBytes;
+    limits.slowConsumerGrace = std::chrono::milliseconds(
+        static_cast<std::int64_t>(zoneConfig_.slowConsumerGraceSec * 1000.0f));
+    connection->setQueueLimits(limits);
+    connection->setMetrics(netMetrics_);
+
+    if (concurrentIo()) {
+        // Called on the connection's I/O strand: only queue, the tick applies it
+        connection->setMessageHandler([this](const req::shared::MessageHeader& header,
+                                             std::string_view payload,
+                                             std::shared_ptr<req::shared::net::Connection> conn) {
+            // Stamped here, not when the tick drains it, so Pong RTTs exclude the queue wait
+            inboundEvents_.push(InboundEvent{ InboundEvent::Kind::Message, header, std::string(payload), std::move(conn),
+                serverTimeMs() });
+        });
+        
+        connection->setDisconnectHandler([this](std::shared_ptr<req::shared::net::Connection> conn) {
+            inboundEvents_.push(InboundEvent{ InboundEvent::Kind::Disconnect, {}, {}, std::move(conn) });
+        });
+    } else {
+        connection->setMessageHandler([this, connection](const req::shared::MessageHeader& header,
+                                             std::string_view payload,
+                                             std::shared_ptr<req::shared::net::Connection> conn) {
+            handleMessage(header, payload, conn);
+        });
+        
+        connection->setDisconnectHandler([this](std::shared_ptr<req::shared::net::Connection> conn) {
+            onConnectionClosed(conn);
+        });
+    }
 
     req::shared::logInfo("zone", std::string{"New client connected to zone \""} + zoneName_ + 
         "\" (id=" + std::to_string(zoneId_) + "), total connections=" + std::to_string(connections_.size()));
     connection->start();
 }
 
+void ZoneServer::drainInboundEvents() {
+    inboundEvents_.drain([this](InboundEvent&& event) {
+        if (event.kind == InboundEvent::Kind::Disconnect) {
+            onConnectionClosed(event.connection);
+        } else {
+            handleMessage(event.header, event.payload, event.connection, event.receivedAtMs);
+        }
+    });
+}
+
 void ZoneServer::onConnectionClosed(ConnectionPtr connection) {
     req::shared::logInfo("zone", "[DISCONNECT] ========== BEGIN DISCONNECT HANDLING ==========");
     req::shared::logInfo("zone", "[DISCONNECT] Connection closed event received");
@@ -96,4 +135,184 @@ void ZoneServer::onConnectionClosed(ConnectionPtr connection) {
     req::shared::logInfo("zone", "[DISCONNECT] ========== END DISCONNECT HANDLING ==========");
 }
 
+void ZoneServer::setConnectionsCorked(bool corked) {
+    for (auto& connection : connections_) {
+        if (connection && !connection->isClosed()) {
+            connection->setCorked(corked);
+        }
+    }
+}
+
+void ZoneServer::startDatagramChannel() {
+    if (!zoneConfig_.udpEnabled) {
+        return;
+    }
+    
+    auto channel = std::make_unique<ZoneDatagramChannel>(
+        simStrand_, zoneConfig_.udpTimeoutSec, zoneConfig_.udpSimulatedLossPercent);
+    std::uint16_t udpPort = zoneConfig_.udpPort != 0 ? zoneConfig_.udpPort : port_;
+    if (!channel->open(address_, udpPort)) {
+        req::shared::logWarn("zone", "[UDP] Side-channel disabled (socket setup failed); all traffic stays on TCP");
+        return;
+    }
+    
+    channel->setMessageHandler([this](std::uint64_t characterId,
+                                      const req::shared::MessageHeader& header,
+                                      std::string_view payload) {
+        onDatagramMessage(characterId, header, payload);
+    });
+    channel->start();
+    datagramChannel_ = std::move(channel);
+}
+
+void ZoneServer::sendUnreliable(const ConnectionPtr& connection, const req::shared::net::Connection::SharedFrame& frame) {
+    if (datagramChannel_) {
+        auto it = connectionToCharacterId_.find(connection);
+        if (it != connectionToCharacterId_.end() && datagramChannel_->sendFrame(it->second, frame)) {
+            return;
+        }
+    }
+    connection->send(frame);
+}
+
+void ZoneServer::onDatagramMessage(std::uint64_t characterId,
+                                   const req::shared::MessageHeader& header,
+                                   std::string_view payload) {
+    // Only input that is superseded by the next one may arrive unreliably
+    if (header.type != req::shared::MessageType::MovementIntent) {
+        req::shared::logWarn("zone", std::string{"[UDP] Ignoring message type "} +
+            std::to_string(static_cast<int>(header.type)) + " from characterId=" + std::to_string(characterId) +
+            " (not allowed on the datagram channel)");
+        return;
+    }
+    
+    auto it = players_.find(characterId);
+    if (it == players_.end() || !it->second.connection) {
+        return;
+    }
+    
+    // Same validation path as TCP, attributed to the player's TCP connection
+    handleMessage(header, payload, it->second.connection);
+}
+
+req::shared::protocol::WireFormat ZoneServer::getWireFormat(const ConnectionPtr& connection) const {
+    auto it = connectionToCharacterId_.find(connection);
+    if (it == connectionToCharacterId_.end()) {
+        return req::shared::protocol::WireFormat::Text;
+    }
+    
+    auto playerIt = players_.find(it->second);
+    if (playerIt == players_.end()) {
+        return req::shared::protocol::WireFormat::Text;
+    }
+    
+    return req::shared::protocol::wireFormatForCapabilities(playerIt->second.capabilities);
+}
+
+const req::shared::protocol::QuantizationParams* ZoneServer::getQuantization(const ZonePlayer& player) const {
+    if (player.capabilities & req::shared::protocol::ZoneCapability::QuantizedState) {
+        return &zoneConfig_.quantization;
+    }
+    return nullptr;
+}
+
+const req::shared::protocol::QuantizationParams* ZoneServer::getQuantization(const ConnectionPtr& connection) const {
+    auto it = connectionToCharacterId_.find(connection);
+    if (it == connectionToCharacterId_.end()) {
+        return nullptr;
+    }
+    
+    auto playerIt = players_.find(it->second);
+    if (playerIt == players_.end()) {
+        return nullptr;
+    }
+    
+    return getQuantization(playerIt->second);
+}
+
+void ZoneServer::scheduleNetStats() {
+    netStatsTimer_.expires_after(std::chrono::milliseconds(
+        static_cast<std::int64_t>(zoneConfig_.netStatsIntervalSec * 1000.0f)));
+    netStatsTimer_.async_wait([this](const boost::system::error_code& ec) {
+        onNetStats(ec);
+    });
+}
+
+void ZoneServer::onNetStats(const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) {
+        return;
+    }
+    
+    std::string summary = netMetrics_->formatSummary();
+    if (datagramChannel_) {
+        const auto& udp = datagramChannel_->getStats();
+        summary += ", udpSent=" + std::to_string(udp.datagramsSent) +
+            ", udpRecv=" + std::to_string(udp.datagramsReceived) +
+            ", udpStale=" + std::to_string(udp.datagramsStale);
+    }
+    req::shared::logInfo("zone", std::string{"[NETSTATS] "} + summary);
+    
+    if (!zoneConfig_.netStatsFile.empty()) {
+        std::ofstream file(zoneConfig_.netStatsFile, std::ios::app);
+        if (file) {
+            file << buildNetStatsReport() << "\n";
+        } else {
+            req::shared::logWarn("zone", std::string{"[NETSTATS] Cannot open net_stats_file: "} + zoneConfig_.netStatsFile);
+        }
+    }
+    
+    scheduleNetStats();
+}
+
+std::string ZoneServer::buildNetStatsReport() const {
+    auto unixTime = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    
+    std::ostringstream oss;
+    oss << "# time=" << unixTime << " zoneId=" << zoneId_ << " players=" << players_.size() << "\n";
+    oss << netMetrics_->formatReport(zoneName_);
+    
+    oss << "Connections:\n";
+    for (const auto& connection : connections_) {
+        if (!connection || connection->isClosed()) {
+            continue;
+        }
+        auto charIt = connectionToCharacterId_.find(connection);
+        auto stats = connection->getStats();
+        oss << "  " << connection->remoteAddress()
+            << " characterId=" << (charIt != connectionToCharacterId_.end() ? std::to_string(charIt->second) : std::string{ "-" });
+        if (charIt != connectionToCharacterId_.end()) {
+            auto playerIt = players_.find(charIt->second);
+            if (playerIt != players_.end() && playerIt->second.latency.hasEstimate()) {
+                const auto& latency = playerIt->second.latency;
+                oss << " srtt=" << latency.smoothedRttMs << "ms rttvar=" << latency.rttVarianceMs
+                    << "ms clockOffset=" << latency.clockOffsetMs << "ms inputDelay=" << latency.lastInputDelayMs << "ms";
+            }
+            if (playerIt != players_.end() &&
+                (playerIt->second.capabilities & req::shared::protocol::ZoneCapability::DeltaSnapshots)) {
+                const auto& baselines = playerIt->second.snapshotBaselines;
+                oss << " snapshotDeltas=" << baselines.deltasSent << " snapshotFull=" << baselines.fullStatesSent
+                    << " ackLag=" << (snapshotCounter_ - std::min(snapshotCounter_, baselines.ackedSnapshotId));
+            }
+        }
+        oss
+            << " sent=" << stats.messagesSent << "/" << stats.bytesSent << "B"
+            << " recv=" << stats.messagesReceived << "/" << stats.bytesReceived << "B"
+            << " writes=" << stats.writes << " bundles=" << stats.bundlesSent
+            << " queue=" << stats.queueDepth << " (high " << stats.queueDepthHighWater << ")"
+            << " pending=" << stats.bytesPending << "B"
+            << " writeLatency p50<=" << stats.writeLatencyP50.count() << "us"
+            << " p99<=" << stats.writeLatencyP99.count() << "us"
+            << " max=" << stats.writeLatencyMax.count() << "us\n";
+    }
+    
+    if (datagramChannel_) {
+        const auto& udp = datagramChannel_->getStats();
+        oss << "UDP: sent=" << udp.datagramsSent << " recv=" << udp.datagramsReceived
+            << " rejected=" << udp.datagramsRejected << " stale=" << udp.datagramsStale
+            << " simulatedLossDrops=" << udp.simulatedLossDrops << "\n";
+    }
+    return oss.str();
+}
+
 } // namespace req::zone
@@ -8,6 +8,9 @@
 #include <random>
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <atomic>
+#include <memory>
 
 // Using declarations for NPC spawn data types
 using req::zone::NpcTemplateData;
@@ -15,6 +18,26 @@ using req::zone::NpcSpawnPointData;
 
 namespace {
     constexpr float MAX_HATE = 1.0e9f; // 1 billion - prevents unbounded growth
+    
+    // NPC level of detail
+    constexpr float NPC_ACTIVITY_CHECK_SEC = 0.5f;  // Nearest-player check interval per NPC
+    constexpr float NPC_MAX_CATCH_UP_SEC = 1.0f;    // Longest step handed to a waking idle NPC
+    
+    constexpr double SPAWN_INTEGRITY_CHECK_SEC = 30.0;
+    
+    // AI jobs are handed out in chunks of at least this many; smaller
+    // chunks balance better but cost an atomic claim each
+    constexpr std::size_t NPC_AI_MIN_CHUNK = 16;
+    
+    // 0..1 from (npcId, tick): the aggro scan jitter must not depend on which
+    // AI thread evaluates the NPC, so it cannot come from a shared generator
+    float aiJitter(std::uint64_t npcId, std::uint64_t tick) {
+        std::uint64_t z = npcId * 0x9E3779B97F4A7C15ull + tick;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        return static_cast<float>(z >> 40) / static_cast<float>(1ull << 24);
+    }
 }
 
 namespace req::zone {
@@ -29,18 +52,19 @@ if (entityId == 0 || amount <= 0.0f) {
 }
 
 // Add or increment hate for this entity with cap
-auto& value = npc.hateTable[entityId];
-value = std::min(value + amount, MAX_HATE);
+if (npc.hateTable.add(entityId, amount, MAX_HATE)) {
+    hatedBy_[entityId].push_back(npc.npcId);
+}
 
-    // Update current target if needed
+    // Update current target if needed (the hate table tracks its top entry)
     std::uint64_t previousTarget = npc.currentTargetId;
-    std::uint64_t newTopTarget = getTopHateTarget(npc);
+    std::uint64_t newTopTarget = npc.hateTable.topTarget();
 
     if (newTopTarget != previousTarget) {
         npc.currentTargetId = newTopTarget;
 
         // Log target swap
-        float topHate = (newTopTarget != 0) ? npc.hateTable[newTopTarget] : 0.0f;
+        float topHate = npc.hateTable.topHate();
         req::shared::logInfo("zone", std::string{"[HATE] NPC "} + std::to_string(npc.npcId) +
             " \"" + npc.name + "\" new_target=" + std::to_string(newTopTarget) +
             " top_hate=" + std::to_string(topHate));
@@ -48,24 +72,11 @@ value = std::min(value + amount, MAX_HATE);
 }
 
 std::uint64_t ZoneServer::getTopHateTarget(const req::shared::data::ZoneNpc& npc) const {
-    if (npc.hateTable.empty()) {
-        return 0;
-    }
-
-    std::uint64_t topTarget = 0;
-    float maxHate = 0.0f;
-
-    for (const auto& [entityId, hate] : npc.hateTable) {
-        if (hate > maxHate) {
-            maxHate = hate;
-            topTarget = entityId;
-        }
-    }
-
-    return topTarget;
+    return npc.hateTable.topTarget();
 }
 
 void ZoneServer::clearHate(req::shared::data::ZoneNpc& npc) {
+    unindexHate(npc);
     npc.hateTable.clear();
     npc.currentTargetId = 0;
 
@@ -73,19 +84,47 @@ void ZoneServer::clearHate(req::shared::data::ZoneNpc& npc) {
         std::to_string(npc.npcId) + " \"" + npc.name + "\"");
 }
 
+void ZoneServer::unindexHate(const req::shared::data::ZoneNpc& npc) {
+    for (const auto& entry : npc.hateTable) {
+        auto indexIt = hatedBy_.find(entry.entityId);
+        if (indexIt == hatedBy_.end()) {
+            continue;
+        }
+        auto& npcIds = indexIt->second;
+        auto pos = std::find(npcIds.begin(), npcIds.end(), npc.npcId);
+        if (pos != npcIds.end()) {
+            *pos = npcIds.back();
+            npcIds.pop_back();
+        }
+        if (npcIds.empty()) {
+            hatedBy_.erase(indexIt);
+        }
+    }
+}
+
 void ZoneServer::removeCharacterFromAllHateTables(std::uint64_t characterId) {
     int numNpcsTouched = 0;
     int numTablesCleared = 0;
 
-    for (auto& [npcId, npc] : npcs_) {
-        // Check if this NPC has hate for the character
-        auto hateIt = npc.hateTable.find(characterId);
-        if (hateIt == npc.hateTable.end()) {
-            continue; // NPC doesn't have hate for this character
+    // Only the NPCs that hate this character, not every NPC in the zone
+    auto indexIt = hatedBy_.find(characterId);
+    if (indexIt == hatedBy_.end()) {
+        return;
+    }
+    std::vector<std::uint64_t> haters = std::move(indexIt->second);
+    hatedBy_.erase(indexIt);
+
+    for (std::uint64_t npcId : haters) {
+        auto npcIt = npcs_.find(npcId);
+        if (npcIt == npcs_.end()) {
+            continue;
         }
+        auto& npc = npcIt->second;
 
         // Remove hate entry
-        npc.hateTable.erase(hateIt);
+        if (!npc.hateTable.remove(characterId)) {
+            continue;
+        }
         numNpcsTouched++;
 
         // Check if hate table is now empty
@@ -95,7 +134,7 @@ void ZoneServer::removeCharacterFromAllHateTables(std::uint64_t characterId) {
 
         // If this was the current target, recompute target
         if (npc.currentTargetId == characterId) {
-            std::uint64_t newTarget = getTopHateTarget(npc);
+            std::uint64_t newTarget = npc.hateTable.topTarget();
             npc.currentTargetId = newTarget;
 
             // If no new target and NPC is engaged, transition to leashing
@@ -119,61 +158,95 @@ void ZoneServer::removeCharacterFromAllHateTables(std::uint64_t characterId) {
 // NPC AI State Machine (Phase 2.3)
 // ============================================================================
 
-void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
+void ZoneServer::evaluateNpcAi(NpcAiJob& job) const {
     using NpcAiState = req::shared::data::NpcAiState;
-
-    // Dead NPCs are handled by respawn system
-    if (!npc.isAlive) {
-        if (npc.aiState != NpcAiState::Dead) {
-            npc.aiState = NpcAiState::Dead;
-        }
-        return;
-    }
+    using Command = NpcAiCommand;
+    
+    // Runs on AI worker threads: reads the zone, writes only 'job'
+    const req::shared::data::ZoneNpc& npc = *job.npc;
+    const float dt = job.dt;
+    job.posX = npc.posX;
+    job.posY = npc.posY;
+    job.posZ = npc.posZ;
+    job.facingDegrees = npc.facingDegrees;
+    job.aggroScanTimer = npc.aggroScanTimer;
+    job.meleeAttackTimer = npc.meleeAttackTimer;
+    job.currentHp = npc.currentHp;
+    job.aiState = npc.aiState;
+    job.commands.clear();
+    
+    auto log = [&job](std::string text) {
+        Command command;
+        command.kind = Command::Kind::Log;
+        command.text = std::move(text);
+        job.commands.push_back(std::move(command));
+    };
+    auto clearOwnHate = [&job, &npc]() {
+        Command command;
+        command.kind = Command::Kind::ClearHate;
+        command.npcId = npc.npcId;
+        job.commands.push_back(std::move(command));
+    };
 
     // Update AI timers
-    npc.aggroScanTimer -= dt;
-    if (npc.aggroScanTimer < 0.0f) {
-        npc.aggroScanTimer = 0.0f;
+    job.aggroScanTimer -= dt;
+    if (job.aggroScanTimer < 0.0f) {
+        job.aggroScanTimer = 0.0f;
     }
 
-    if (npc.meleeAttackTimer > 0.0f) {
-        npc.meleeAttackTimer -= dt;
+    if (job.meleeAttackTimer > 0.0f) {
+        job.meleeAttackTimer -= dt;
     }
 
     // AI State Machine
     switch (npc.aiState) {
         case NpcAiState::Idle: {
             // Low-frequency proximity scan (every 0.5-1.0s)
-            if (npc.aggroScanTimer <= 0.0f) {
-                npc.aggroScanTimer = 0.5f + (static_cast<float>(rand()) / RAND_MAX) * 0.5f;  // 0.5-1.0s
+            if (job.aggroScanTimer <= 0.0f) {
+                job.aggroScanTimer = 0.5f + aiJitter(npc.npcId, simulationTick_) * 0.5f;  // 0.5-1.0s
 
-                // Scan for players within aggro radius
+                // Scan for players within aggro radius; only the player grid
+                // cells around the NPC are visited, so a mob with nobody
+                // nearby costs a few empty-cell lookups
                 const float aggroRadiusUnits = npc.behaviorParams.aggroRadius;
 
-                for (const auto& [characterId, player] : players_) {
-                    if (!player.isInitialized || player.isDead) {
-                        continue;
-                    }
+                playerGrid_.forEachInRadius(npc.posX, npc.posY, aggroRadiusUnits,
+                    [&](std::uint64_t characterId, float, float) {
+                        auto playerIt = players_.find(characterId);
+                        if (playerIt == players_.end()) {
+                            return true;
+                        }
+                        const ZonePlayer& player = playerIt->second;
+                        if (!player.isInitialized || player.isDead) {
+                            return true;
+                        }
 
-                    // Calculate distance
-                    float dx = player.posX - npc.posX;
-                    float dy = player.posY - npc.posY;
-                    float dz = player.posZ - npc.posZ;
-                    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+                        // Calculate distance (grid is 2D; aggro range is 3D)
+                        float dx = player.posX - npc.posX;
+                        float dy = player.posY - npc.posY;
+                        float dz = player.posZ - npc.posZ;
+                        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
 
-                    // Check if player is within aggro range
-                    if (distance <= aggroRadiusUnits) {
-                        // Proximity aggro!
-                        addHate(npc, characterId, 1.0f);  // Initial hate
-                        npc.aiState = NpcAiState::Alert;
+                        // Check if player is within aggro range
+                        if (distance > aggroRadiusUnits) {
+                            return true;
+                        }
 
-                        req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                        // Proximity aggro!
+                        Command hate;
+                        hate.kind = Command::Kind::AddHate;
+                        hate.npcId = npc.npcId;
+                        hate.entityId = characterId;
+                        hate.amount = 1.0f;  // Initial hate
+                        job.commands.push_back(std::move(hate));
+                        job.aiState = NpcAiState::Alert;
+
+                        log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                             " \"" + npc.name + "\" state=Idle->Alert (proximity aggro)" +
                             ", target=" + std::to_string(characterId) +
                             ", distance=" + std::to_string(distance));
-                        break;
-                    }
-                }
+                        return false;
+                    });
             }
             break;
         }
@@ -182,10 +255,10 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
             // Quick validation before engaging
             if (npc.currentTargetId == 0) {
                 // No target, return to idle
-                clearHate(npc);
-                npc.aiState = NpcAiState::Idle;
+                clearOwnHate();
+                job.aiState = NpcAiState::Idle;
 
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Alert->Idle (no target)");
                 break;
             }
@@ -194,54 +267,58 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
             auto targetIt = players_.find(npc.currentTargetId);
             if (targetIt == players_.end() || !targetIt->second.isInitialized || targetIt->second.isDead) {
                 // Target invalid, return to idle
-                clearHate(npc);
-                npc.aiState = NpcAiState::Idle;
+                clearOwnHate();
+                job.aiState = NpcAiState::Idle;
 
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Alert->Idle (invalid target)");
                 break;
             }
 
             // Target valid, engage!
-            npc.aiState = NpcAiState::Engaged;
+            job.aiState = NpcAiState::Engaged;
 
-            req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+            log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                 " \"" + npc.name + "\" state=Alert->Engaged" +
                 ", target=" + std::to_string(npc.currentTargetId));
 
-            // Social aggro: alert nearby NPCs
+            // Social aggro: alert nearby NPCs (applied only to those still idle then)
             if (npc.behaviorFlags.isSocial) {
                 const float socialRadiusUnits = npc.behaviorParams.socialRadius;
 
-                for (auto& [otherId, otherNpc] : npcs_) {
-                    if (otherId == npc.npcId || !otherNpc.isAlive) {
-                        continue;
-                    }
+                npcGrid_.forEachInRadius(npc.posX, npc.posY, socialRadiusUnits,
+                    [&](std::uint64_t otherId, float, float) {
+                        if (otherId == npc.npcId) {
+                            return;
+                        }
+                        auto otherIt = npcs_.find(otherId);
+                        if (otherIt == npcs_.end() || !otherIt->second.isAlive) {
+                            return;
+                        }
+                        const auto& otherNpc = otherIt->second;
 
-                    // Check same faction (simple check for now)
-                    if (otherNpc.factionId != npc.factionId) {
-                        continue;
-                    }
+                        // Check same faction (simple check for now)
+                        if (otherNpc.factionId != npc.factionId) {
+                            return;
+                        }
 
-                    // Check distance
-                    float dx = otherNpc.posX - npc.posX;
-                    float dy = otherNpc.posY - npc.posY;
-                    float dz = otherNpc.posZ - npc.posZ;
-                    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
-
-                    if (distance <= socialRadiusUnits) {
-                        // Alert this NPC
-                        if (otherNpc.aiState == NpcAiState::Idle) {
-                            addHate(otherNpc, npc.currentTargetId, 0.5f);  // Social hate
-                            otherNpc.aiState = NpcAiState::Alert;
-
-                            req::shared::logInfo("zone", std::string{"[AI] Social assist: NPC "} +
-                                std::to_string(otherId) + " \"" + otherNpc.name + "\"" +
-                                " assisting NPC " + std::to_string(npc.npcId) +
-                                ", distance=" + std::to_string(distance));
+                        // Check distance
+                        float dx = otherNpc.posX - npc.posX;
+                        float dy = otherNpc.posY - npc.posY;
+                        float dz = otherNpc.posZ - npc.posZ;
+                        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+                        if (distance <= socialRadiusUnits && otherNpc.aiState == NpcAiState::Idle) {
+                            Command assist;
+                            assist.kind = Command::Kind::AssistAlert;
+                            assist.npcId = otherId;
+                            assist.entityId = npc.currentTargetId;
+                            assist.sourceNpcId = npc.npcId;
+                            assist.amount = 0.5f;  // Social hate
+                            assist.distance = distance;
+                            job.commands.push_back(std::move(assist));
                         }
-                    }
-                }
+                    });
             }
             break;
         }
@@ -251,9 +328,9 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
             std::uint64_t targetId = getTopHateTarget(npc);
             if (targetId == 0) {
                 // No target, leash back
-                npc.aiState = NpcAiState::Leashing;
+                job.aiState = NpcAiState::Leashing;
 
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Engaged->Leashing (no target)");
                 break;
             }
@@ -261,15 +338,15 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
             auto targetIt = players_.find(targetId);
             if (targetIt == players_.end() || !targetIt->second.isInitialized || targetIt->second.isDead) {
                 // Target died or disconnected, leash back
-                clearHate(npc);
-                npc.aiState = NpcAiState::Leashing;
+                clearOwnHate();
+                job.aiState = NpcAiState::Leashing;
 
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Engaged->Leashing (target lost)");
                 break;
             }
 
-            ZonePlayer& target = targetIt->second;
+            const ZonePlayer& target = targetIt->second;
 
             // Calculate distance to target
             float dx = target.posX - npc.posX;
@@ -287,10 +364,10 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
             const float maxChaseUnits = npc.behaviorParams.maxChaseDistance;
 
             if (npc.behaviorFlags.leashToSpawn && (distFromSpawn > leashRadiusUnits || distance > maxChaseUnits)) {
-                clearHate(npc);
-                npc.aiState = NpcAiState::Leashing;
+                clearOwnHate();
+                job.aiState = NpcAiState::Leashing;
 
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Engaged->Leashing (exceeded leash)" +
                     ", distFromSpawn=" + std::to_string(distFromSpawn) +
                     ", distToTarget=" + std::to_string(distance));
@@ -301,9 +378,9 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
             if (npc.behaviorFlags.canFlee && npc.behaviorParams.fleeHealthPercent > 0.0f) {
                 float healthPercent = static_cast<float>(npc.currentHp) / static_cast<float>(npc.maxHp);
                 if (healthPercent <= npc.behaviorParams.fleeHealthPercent) {
-                    npc.aiState = NpcAiState::Fleeing;
+                    job.aiState = NpcAiState::Fleeing;
 
-                    req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                    log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                         " \"" + npc.name + "\" state=Engaged->Fleeing" +
                         ", hp=" + std::to_string(npc.currentHp) + "/" + std::to_string(npc.maxHp));
                     break;
@@ -318,42 +395,24 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
                 float moveX = dx / distance;
                 float moveY = dy / distance;
 
-                npc.posX += moveX * npc.moveSpeed * dt;
-                npc.posY += moveY * npc.moveSpeed * dt;
+                job.posX += moveX * npc.moveSpeed * dt;
+                job.posY += moveY * npc.moveSpeed * dt;
 
                 // Update facing
-                npc.facingDegrees = std::atan2(dy, dx) * 180.0f / 3.14159f;
-            } else {
-                // In melee range - attack if cooldown ready
-                if (npc.meleeAttackTimer <= 0.0f) {
-                    // Perform melee attack
-                    static std::mt19937 rng(std::random_device{}());
-                    std::uniform_int_distribution<int> damageDist(npc.minDamage, npc.maxDamage);
-                    int damage = damageDist(rng);
-
-                    // Apply damage
-                    target.hp -= damage;
-                    target.combatStatsDirty = true;
-
-                    req::shared::logInfo("zone", std::string{"[COMBAT] NPC "} + std::to_string(npc.npcId) +
-                        " \"" + npc.name + "\" melee attack" +
-                        ", target=" + std::to_string(target.characterId) +
-                        ", damage=" + std::to_string(damage) +
-                        ", targetHp=" + std::to_string(target.hp) + "/" + std::to_string(target.maxHp));
-
-                    // Check if player died
-                    if (target.hp <= 0) {
-                        handlePlayerDeath(target);
-                        clearHate(npc);
-                        npc.aiState = NpcAiState::Leashing;
-
-                        req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
-                            " state=Engaged->Leashing (target died)");
-                    }
-
-                    // Reset attack cooldown
-                    npc.meleeAttackTimer = npc.meleeAttackCooldown;
-                }
+                job.facingDegrees = std::atan2(dy, dx) * 180.0f / 3.14159f;
+            } else if (job.meleeAttackTimer <= 0.0f) {
+                // In melee range and cooldown ready: the damage roll, the hit
+                // and any resulting death happen in the apply phase
+                Command attack;
+                attack.kind = Command::Kind::MeleeAttack;
+                attack.npcId = npc.npcId;
+                attack.entityId = target.characterId;
+                attack.minDamage = npc.minDamage;
+                attack.maxDamage = npc.maxDamage;
+                job.commands.push_back(std::move(attack));
+
+                // Reset attack cooldown
+                job.meleeAttackTimer = npc.meleeAttackCooldown;
             }
             break;
         }
@@ -369,22 +428,22 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
 
             if (distance <= SPAWN_EPSILON) {
                 // Reached spawn - reset to idle
-                npc.posX = npc.spawnX;
-                npc.posY = npc.spawnY;
-                npc.posZ = npc.spawnZ;
-                npc.currentHp = npc.maxHp;  // Heal to full on leash
-                clearHate(npc);
-                npc.aiState = NpcAiState::Idle;
-
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                job.posX = npc.spawnX;
+                job.posY = npc.spawnY;
+                job.posZ = npc.spawnZ;
+                job.currentHp = npc.maxHp;  // Heal to full on leash
+                clearOwnHate();
+                job.aiState = NpcAiState::Idle;
+
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Leashing->Idle (reached spawn, reset)");
             } else {
                 // Move toward spawn
                 float moveX = dx / distance;
                 float moveY = dy / distance;
 
-                npc.posX += moveX * npc.moveSpeed * dt;
-                npc.posY += moveY * npc.moveSpeed * dt;
+                job.posX += moveX * npc.moveSpeed * dt;
+                job.posY += moveY * npc.moveSpeed * dt;
             }
             break;
         }
@@ -405,37 +464,194 @@ void ZoneServer::updateNpcAi(req::shared::data::ZoneNpc& npc, float dt) {
                         float moveX = dx / distance;
                         float moveY = dy / distance;
 
-                        npc.posX += moveX * npc.moveSpeed * dt;
-                        npc.posY += moveY * npc.moveSpeed * dt;
+                        job.posX += moveX * npc.moveSpeed * dt;
+                        job.posY += moveY * npc.moveSpeed * dt;
 
                         // Update facing (running away)
-                        npc.facingDegrees = std::atan2(moveY, moveX) * 180.0f / 3.14159f;
+                        job.facingDegrees = std::atan2(moveY, moveX) * 180.0f / 3.14159f;
                     }
                 }
             }
 
             // Check if far enough to switch to leashing
-            float dxSpawn = npc.posX - npc.spawnX;
-            float dySpawn = npc.posY - npc.spawnY;
+            float dxSpawn = job.posX - npc.spawnX;
+            float dySpawn = job.posY - npc.spawnY;
             float distFromSpawn = std::sqrt(dxSpawn * dxSpawn + dySpawn * dySpawn);
 
             const float leashRadiusUnits = npc.behaviorParams.leashRadius;
             if (distFromSpawn > leashRadiusUnits * 0.8f) {  // 80% of leash radius
-                npc.aiState = NpcAiState::Leashing;
+                job.aiState = NpcAiState::Leashing;
 
-                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                log(std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
                     " state=Fleeing->Leashing (reached safe distance)");
             }
             break;
         }
 
         case NpcAiState::Dead: {
-            // Already handled at top of function
+            // Only living NPCs get an AI job
             break;
         }
     }
 }
 
+void ZoneServer::applyNpcAiCommand(const NpcAiCommand& command) {
+    using NpcAiState = req::shared::data::NpcAiState;
+    using Kind = NpcAiCommand::Kind;
+    
+    if (command.kind == Kind::Log) {
+        req::shared::logInfo("zone", command.text);
+        return;
+    }
+    
+    auto npcIt = npcs_.find(command.npcId);
+    if (npcIt == npcs_.end()) {
+        return;
+    }
+    auto& npc = npcIt->second;
+    
+    switch (command.kind) {
+        case Kind::AddHate:
+            addHate(npc, command.entityId, command.amount);
+            break;
+            
+        case Kind::ClearHate:
+            clearHate(npc);
+            break;
+            
+        case Kind::AssistAlert: {
+            // An earlier command this tick may already have woken it
+            if (!npc.isAlive || npc.aiState != NpcAiState::Idle) {
+                break;
+            }
+            addHate(npc, command.entityId, command.amount);
+            npc.aiState = NpcAiState::Alert;
+
+            req::shared::logInfo("zone", std::string{"[AI] Social assist: NPC "} +
+                std::to_string(npc.npcId) + " \"" + npc.name + "\"" +
+                " assisting NPC " + std::to_string(command.sourceNpcId) +
+                ", distance=" + std::to_string(command.distance));
+            break;
+        }
+            
+        case Kind::MeleeAttack: {
+            // The target may have died or left since the NPC decided to swing;
+            // the NPC notices on its next update
+            auto targetIt = players_.find(command.entityId);
+            if (targetIt == players_.end() || !targetIt->second.isInitialized || targetIt->second.isDead) {
+                break;
+            }
+            ZonePlayer& target = targetIt->second;
+            
+            // Rolled here, in NPC order, so results do not depend on AI threads
+            std::uniform_int_distribution<int> damageDist(command.minDamage, command.maxDamage);
+            int damage = damageDist(rng_);
+
+            // Apply damage
+            target.hp -= damage;
+            target.combatStatsDirty = true;
+
+            req::shared::logInfo("zone", std::string{"[COMBAT] NPC "} + std::to_string(npc.npcId) +
+                " \"" + npc.name + "\" melee attack" +
+                ", target=" + std::to_string(target.characterId) +
+                ", damage=" + std::to_string(damage) +
+                ", targetHp=" + std::to_string(target.hp) + "/" + std::to_string(target.maxHp));
+
+            // Check if player died
+            if (target.hp <= 0) {
+                handlePlayerDeath(target);
+                clearHate(npc);
+                npc.aiState = NpcAiState::Leashing;
+
+                req::shared::logInfo("zone", std::string{"[AI] NPC "} + std::to_string(npc.npcId) +
+                    " state=Engaged->Leashing (target died)");
+            }
+            break;
+        }
+            
+        case Kind::Log:
+            break;
+    }
+}
+
+void ZoneServer::runNpcAiPhase(std::size_t jobCount) {
+    if (jobCount == 0) {
+        return;
+    }
+    
+    // Evaluate: nothing in the zone is written until every job is done
+    if (!npcAiPool_ || npcAiWorkers_ == 0 || jobCount < zoneConfig_.npcAiParallelMin) {
+        for (std::size_t i = 0; i < jobCount; ++i) {
+            evaluateNpcAi(npcAiJobs_[i]);
+        }
+    } else {
+        // Workers and this thread claim chunks from a shared counter. The
+        // pool may be shared with other zones (ZoneHost): if its workers are
+        // busy, this thread simply does more chunks itself, and only waits
+        // for chunks a worker has already started.
+        struct Phase {
+            std::atomic<std::size_t> nextChunk{ 0 };
+            std::atomic<std::size_t> chunksDone{ 0 };
+            std::size_t chunkCount{ 0 };
+            std::size_t chunkSize{ 0 };
+            std::size_t jobCount{ 0 };
+        };
+        auto phase = std::make_shared<Phase>();
+        phase->jobCount = jobCount;
+        phase->chunkSize = std::max(NPC_AI_MIN_CHUNK, jobCount / ((npcAiWorkers_ + 1) * 4));
+        phase->chunkCount = (jobCount + phase->chunkSize - 1) / phase->chunkSize;
+        
+        // A worker that starts after every chunk is claimed returns without
+        // touching the zone; 'phase' keeps the counters alive for it
+        auto runChunks = [this, phase]() {
+            for (;;) {
+                std::size_t chunk = phase->nextChunk.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= phase->chunkCount) {
+                    return;
+                }
+                std::size_t begin = chunk * phase->chunkSize;
+                std::size_t end = std::min(begin + phase->chunkSize, phase->jobCount);
+                for (std::size_t i = begin; i < end; ++i) {
+                    evaluateNpcAi(npcAiJobs_[i]);
+                }
+                if (phase->chunksDone.fetch_add(1, std::memory_order_acq_rel) + 1 == phase->chunkCount) {
+                    phase->chunksDone.notify_all();
+                }
+            }
+        };
+        
+        const std::size_t helpers = std::min<std::size_t>(npcAiWorkers_, phase->chunkCount - 1);
+        for (std::size_t i = 0; i < helpers; ++i) {
+            boost::asio::post(*npcAiPool_, runChunks);
+        }
+        runChunks();
+        
+        for (std::size_t done = phase->chunksDone.load(std::memory_order_acquire); done < phase->chunkCount;
+             done = phase->chunksDone.load(std::memory_order_acquire)) {
+            phase->chunksDone.wait(done, std::memory_order_acquire);
+        }
+    }
+    
+    // Apply: each NPC's own fields, then everyone's commands, in NPC order
+    for (std::size_t i = 0; i < jobCount; ++i) {
+        const NpcAiJob& job = npcAiJobs_[i];
+        auto& npc = *job.npc;
+        npc.posX = job.posX;
+        npc.posY = job.posY;
+        npc.posZ = job.posZ;
+        npc.facingDegrees = job.facingDegrees;
+        npc.aggroScanTimer = job.aggroScanTimer;
+        npc.meleeAttackTimer = job.meleeAttackTimer;
+        npc.currentHp = job.currentHp;
+        npc.aiState = job.aiState;
+    }
+    for (std::size_t i = 0; i < jobCount; ++i) {
+        for (const auto& command : npcAiJobs_[i].commands) {
+            applyNpcAiCommand(command);
+        }
+    }
+}
+
 // ============================================================================
 // Original functions (kept for compatibility)
 // ============================================================================
@@ -492,8 +708,82 @@ void ZoneServer::updateNpc(req::shared::data::ZoneNpc& npc, float deltaSeconds)
         return;
     }
 
-    // Run AI state machine
-    updateNpcAi(npc, deltaSeconds);
+    // Living NPCs go through the AI phase (runNpcAiPhase)
+}
+
+// ============================================================================
+// Simulation Level of Detail
+// ============================================================================
+
+req::shared::data::NpcActivity ZoneServer::classifyNpcActivity(const req::shared::data::ZoneNpc& npc) const {
+    using NpcActivity = req::shared::data::NpcActivity;
+    
+    if (playerGrid_.size() == 0) {
+        return NpcActivity::Asleep;
+    }
+    
+    const float activeRadiusSq = zoneConfig_.npcActiveRadius * zoneConfig_.npcActiveRadius;
+    NpcActivity activity = NpcActivity::Asleep;
+    playerGrid_.forEachInRadius(npc.posX, npc.posY, zoneConfig_.npcWakeRadius,
+        [&](std::uint64_t, float x, float y) {
+            float dx = x - npc.posX;
+            float dy = y - npc.posY;
+            if (dx * dx + dy * dy <= activeRadiusSq) {
+                activity = NpcActivity::Active;
+                return false;
+            }
+            activity = NpcActivity::Reduced;
+            return true;
+        });
+    return activity;
+}
+
+float ZoneServer::npcSimulationStep(req::shared::data::ZoneNpc& npc, float deltaSeconds) {
+    using NpcActivity = req::shared::data::NpcActivity;
+    using NpcAiState = req::shared::data::NpcAiState;
+    
+    npc.unsimulatedSec += deltaSeconds;
+    
+    bool due = true;
+    if (zoneConfig_.npcSleepEnabled) {
+        npc.activityCheckTimer -= deltaSeconds;
+        if (npc.activityCheckTimer <= 0.0f) {
+            npc.activity = classifyNpcActivity(npc);
+            npc.activityCheckTimer = NPC_ACTIVITY_CHECK_SEC;
+        }
+        
+        if (!npc.isAlive) {
+            // Dead NPCs only need ticks that change something: starting the
+            // respawn countdown and the tick it runs out, so it stays exact
+            due = !npc.pendingRespawn || npc.unsimulatedSec >= npc.respawnTimerSec;
+        } else if (npc.aiState == NpcAiState::Idle) {
+            switch (npc.activity) {
+                case NpcActivity::Active:
+                    due = true;
+                    break;
+                case NpcActivity::Reduced:
+                    // Staggered by id so the reduced band is spread over the interval
+                    due = (simulationTick_ + npc.npcId) % zoneConfig_.npcReducedTickInterval == 0;
+                    break;
+                case NpcActivity::Asleep:
+                    due = false;
+                    break;
+            }
+        }
+        // Any other AI state (fighting, leashing, fleeing) runs every tick
+    }
+    
+    if (!due) {
+        return 0.0f;
+    }
+    
+    float step = npc.unsimulatedSec;
+    npc.unsimulatedSec = 0.0f;
+    if (npc.isAlive && step > NPC_MAX_CATCH_UP_SEC) {
+        // An idle NPC only has cooldowns to run down; a long sleep needs no replay
+        step = NPC_MAX_CATCH_UP_SEC;
+    }
+    return step;
 }
 
 // ============================================================================
@@ -512,6 +802,7 @@ void ZoneServer::initializeSpawnRecords() {
     // Get current time for initial spawn scheduling
     auto now = std::chrono::system_clock::now();
     double currentTime = std::chrono::duration<double>(now.time_since_epoch()).count();
+    timers_.reset(currentTime);
     
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -544,6 +835,7 @@ void ZoneServer::initializeSpawnRecords() {
         float initialOffset = offsetDist(gen);
         record.next_spawn_time = currentTime + initialOffset;
         record.current_entity_id = 0;
+        noteSpawnDue(record);
         
         // Store in map
         spawnRecords_[spawn.spawnId] = record;
@@ -559,17 +851,60 @@ void ZoneServer::initializeSpawnRecords() {
     
     req::shared::logInfo("zone", std::string{"[SPAWN] Initialized "} + std::to_string(recordCount) +
         " spawn record(s) from " + std::to_string(spawns.size()) + " spawn point(s)");
+    
+    if (recordCount > 0) {
+        scheduleTimer(ZoneTimerKind::SpawnIntegrity, 0, currentTime + SPAWN_INTEGRITY_CHECK_SEC);
+    }
+}
+
+void ZoneServer::processSpawnTimer(std::int32_t spawnPointId, double currentTime) {
+    auto it = spawnRecords_.find(spawnPointId);
+    if (it == spawnRecords_.end()) {
+        return;
+    }
+    SpawnRecord& record = it->second;
+    
+    // Timers are not cancelled: skip one for a record that has spawned since
+    // or was rescheduled to a later time (that time has its own timer)
+    if (record.state != SpawnState::WaitingToSpawn || currentTime < record.next_spawn_time) {
+        return;
+    }
+    
+    spawnNpcAtPoint(record, currentTime);
+    if (record.state == SpawnState::WaitingToSpawn) {
+        // Spawn failed and was pushed back
+        noteSpawnDue(record);
+    }
 }
 
-void ZoneServer::processSpawns(float deltaSeconds, double currentTime) {
+void ZoneServer::noteSpawnDue(const SpawnRecord& record) {
+    scheduleTimer(ZoneTimerKind::SpawnDue, static_cast<std::uint64_t>(record.spawn_point_id), record.next_spawn_time);
+}
+
+void ZoneServer::checkSpawnIntegrity(double currentTime) {
+    scheduleTimer(ZoneTimerKind::SpawnIntegrity, 0, currentTime + SPAWN_INTEGRITY_CHECK_SEC);
+    
+    int repairCount = 0;
     for (auto& [spawnId, record] : spawnRecords_) {
-        if (record.state == SpawnState::WaitingToSpawn) {
-            // Check if it's time to spawn
-            if (currentTime >= record.next_spawn_time) {
-                spawnNpcAtPoint(record, currentTime);
+        if (record.state == SpawnState::Alive && record.current_entity_id != 0) {
+            // Verify NPC actually exists
+            auto npcIt = npcs_.find(record.current_entity_id);
+            if (npcIt == npcs_.end()) {
+                req::shared::logWarn("zone", std::string{"[SPAWN] Integrity check: NPC "} +
+                    std::to_string(record.current_entity_id) + " from spawn " +
+                    std::to_string(spawnId) + " does not exist - repairing spawn record");
+                record.state = SpawnState::WaitingToSpawn;
+                record.current_entity_id = 0;
+                record.next_spawn_time = currentTime + record.respawn_seconds;
+                noteSpawnDue(record);
+                repairCount++;
             }
         }
-        // Alive spawns are managed by NPC death system
+    }
+    
+    if (repairCount > 0) {
+        req::shared::logWarn("zone", std::string{"[SPAWN] Integrity check repaired "} +
+            std::to_string(repairCount) + " spawn record(s)");
     }
 }
 
@@ -650,6 +985,7 @@ void ZoneServer::spawnNpcAtPoint(SpawnRecord& record, double currentTime) {
     
     // Add to zone
     npcs_[npc.npcId] = npc;
+    npcGrid_.update(npc.npcId, npc.posX, npc.posY);
     
     // Update spawn record
     record.state = SpawnState::Alive;
@@ -682,6 +1018,7 @@ void ZoneServer::scheduleRespawn(std::int32_t spawnPointId, double currentTime)
     record.state = SpawnState::WaitingToSpawn;
     record.next_spawn_time = currentTime + record.respawn_seconds + jitter;
     record.current_entity_id = 0;
+    noteSpawnDue(record);
     
     req::shared::logInfo("zone", std::string{"[SPAWN] Scheduled respawn: spawn_id="} +
         std::to_string(spawnPointId) + ", npc_id=" + std::to_string(record.npc_template_id) +
@@ -13,43 +13,14 @@ void ZoneServer::savePlayerPosition(std::uint64_t characterId) {
         return;
     }
     
-    const ZonePlayer& player = playerIt->second;
+    ZonePlayer& player = playerIt->second;
     
     // Wrap entire save operation in try-catch
     try {
-        // Load character from disk
-        auto character = characterStore_.loadById(characterId);
-        if (!character.has_value()) {
-            req::shared::logWarn("zone", std::string{"[SAVE] Cannot save position - character not found on disk: characterId="} +
-                std::to_string(characterId));
-            return;
-        }
-        
-        // Update position fields
-        character->lastWorldId = worldId_;
-        character->lastZoneId = zoneId_;
-        character->positionX = player.posX;
-        character->positionY = player.posY;
-        character->positionZ = player.posZ;
-        character->heading = player.yawDegrees;
+        // The in-memory record is authoritative; bring the live fields into it
+        refreshCharacterRecord(player);
         
-        // Update combat state if dirty
         if (player.combatStatsDirty) {
-            character->level = player.level;
-            character->xp = player.xp;
-            character->hp = player.hp;
-            character->maxHp = player.maxHp;
-            character->mana = player.mana;
-            character->maxMana = player.maxMana;
-            
-            character->strength = player.strength;
-            character->stamina = player.stamina;
-            character->agility = player.agility;
-            character->dexterity = player.dexterity;
-            character->intelligence = player.intelligence;
-            character->wisdom = player.wisdom;
-            character->charisma = player.charisma;
-            
             req::shared::logInfo("zone", std::string{"[SAVE] Combat stats saved: characterId="} +
                 std::to_string(characterId) + ", level=" + std::to_string(player.level) +
                 ", xp=" + std::to_string(player.xp) + ", hp=" + std::to_string(player.hp) + "/" +
@@ -57,20 +28,17 @@ void ZoneServer::savePlayerPosition(std::uint64_t characterId) {
                 std::to_string(player.maxMana));
         }
         
-        // Save to disk
-        if (characterStore_.saveCharacter(*character)) {
-            req::shared::logInfo("zone", std::string{"[SAVE] Position saved successfully: characterId="} +
-                std::to_string(characterId) + ", zoneId=" + std::to_string(zoneId_) +
-                ", pos=(" + std::to_string(player.posX) + "," + std::to_string(player.posY) + "," +
-                std::to_string(player.posZ) + "), yaw=" + std::to_string(player.yawDegrees));
-            
-            // Mark as clean after successful save
-            playerIt->second.isDirty = false;
-            playerIt->second.combatStatsDirty = false;
-        } else {
-            req::shared::logError("zone", std::string{"[SAVE] Failed to save character to disk: characterId="} +
-                std::to_string(characterId));
-        }
+        // Hand a snapshot to the write-behind queue; a failed write is
+        // reported back through drainCharacterSaveFailures
+        characterSaves_.submit(player.character, characterSaveFailures_);
+        req::shared::logInfo("zone", std::string{"[SAVE] Position queued: characterId="} +
+            std::to_string(characterId) + ", zoneId=" + std::to_string(zoneId_) +
+            ", pos=(" + std::to_string(player.posX) + "," + std::to_string(player.posY) + "," +
+            std::to_string(player.posZ) + "), yaw=" + std::to_string(player.yawDegrees));
+        
+        // Mark as clean; the snapshot holds this state now
+        player.isDirty = false;
+        player.combatStatsDirty = false;
     } catch (const std::exception& e) {
         req::shared::logError("zone", std::string{"[SAVE] Exception during save: characterId="} +
             std::to_string(characterId) + ", error: " + e.what());
@@ -82,6 +50,34 @@ void ZoneServer::savePlayerPosition(std::uint64_t characterId) {
     }
 }
 
+void ZoneServer::refreshCharacterRecord(ZonePlayer& player) {
+    auto& character = player.character;
+    
+    // Position
+    character.lastWorldId = worldId_;
+    character.lastZoneId = zoneId_;
+    character.positionX = player.posX;
+    character.positionY = player.posY;
+    character.positionZ = player.posZ;
+    character.heading = player.yawDegrees;
+    
+    // Combat state
+    character.level = player.level;
+    character.xp = player.xp;
+    character.hp = player.hp;
+    character.maxHp = player.maxHp;
+    character.mana = player.mana;
+    character.maxMana = player.maxMana;
+    
+    character.strength = player.strength;
+    character.stamina = player.stamina;
+    character.agility = player.agility;
+    character.dexterity = player.dexterity;
+    character.intelligence = player.intelligence;
+    character.wisdom = player.wisdom;
+    character.charisma = player.charisma;
+}
+
 void ZoneServer::saveAllPlayerPositions() {
     int savedCount = 0;
     int skippedCount = 0;
@@ -114,11 +110,43 @@ void ZoneServer::saveAllPlayerPositions() {
         }
     }
     
-    if (savedCount > 0 || failedCount > 0) {
+    // Characters whose last write failed and who were not saved again since
+    // (e.g. they left the zone) get another attempt
+    std::size_t retried = characterSaves_.retryFailed();
+    
+    if (savedCount > 0 || failedCount > 0 || retried > 0) {
+        auto stats = characterSaves_.stats();
         req::shared::logInfo("zone", std::string{"[AUTOSAVE] Complete: saved="} +
             std::to_string(savedCount) + ", skipped=" + std::to_string(skippedCount) +
-            ", failed=" + std::to_string(failedCount));
+            ", failed=" + std::to_string(failedCount) + ", retried=" + std::to_string(retried) +
+            ", queue: pending=" + std::to_string(stats.pending) +
+            ", written=" + std::to_string(stats.written) +
+            ", coalesced=" + std::to_string(stats.coalesced) +
+            ", writeFailures=" + std::to_string(stats.failed) +
+            ", maxPending=" + std::to_string(stats.maxPending));
+    }
+}
+
+std::optional<req::shared::data::Character> ZoneServer::loadCharacter(std::uint64_t characterId) const {
+    // A queued snapshot is newer than the file (and the file may be mid-write)
+    if (auto pending = characterSaves_.latest(characterId)) {
+        return pending;
     }
+    return characterStore_.loadById(characterId);
+}
+
+void ZoneServer::drainCharacterSaveFailures() {
+    characterSaveFailures_->drain([this](CharacterSaveQueue::Failure failure) {
+        req::shared::logError("zone", std::string{"[SAVE] Failed to save character to disk: characterId="} +
+            std::to_string(failure.characterId) + " (kept for retry)");
+        
+        // Still here: the next autosave writes the player's state again
+        auto playerIt = players_.find(failure.characterId);
+        if (playerIt != players_.end()) {
+            playerIt->second.isDirty = true;
+            playerIt->second.combatStatsDirty = true;
+        }
+    });
 }
 
 void ZoneServer::scheduleAutosave() {
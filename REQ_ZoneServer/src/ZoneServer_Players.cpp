@@ -3,6 +3,19 @@
 #include "../../REQ_Shared/include/req/shared/Logger.h"
 #include "../../REQ_Shared/include/req/shared/DataModels.h"
 
+#include <cctype>
+
+namespace {
+    // Character names compare case-insensitively (ASCII)
+    std::string characterNameKey(std::string_view name) {
+        std::string key(name);
+        for (char& c : key) {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return key;
+    }
+}
+
 namespace req::zone {
 
 void ZoneServer::spawnPlayer(req::shared::data::Character& character, ZonePlayer& player) {
@@ -52,13 +65,9 @@ void ZoneServer::spawnPlayer(req::shared::data::Character& character, ZonePlayer
         character.heading = player.yawDegrees;
         
         // Save updated character data
-        if (characterStore_.saveCharacter(character)) {
-            req::shared::logInfo("zone", std::string{"[SPAWN] Updated character lastZone/position: characterId="} +
-                std::to_string(character.characterId) + ", lastZoneId=" + std::to_string(zoneId_));
-        } else {
-            req::shared::logWarn("zone", std::string{"[SPAWN] Failed to save character position: characterId="} +
-                std::to_string(character.characterId));
-        }
+        characterSaves_.submit(character, characterSaveFailures_);
+        req::shared::logInfo("zone", std::string{"[SPAWN] Queued character lastZone/position update: characterId="} +
+            std::to_string(character.characterId) + ", lastZoneId=" + std::to_string(zoneId_));
     }
     
     // Initialize velocity
@@ -90,14 +99,33 @@ void ZoneServer::spawnPlayer(req::shared::data::Character& character, ZonePlayer
 
 void ZoneServer::setZoneConfig(const ZoneConfig& config) {
     zoneConfig_ = config;
+    
+    // Grid cells follow the interest radius so a snapshot query touches 3x3 cells
+    playerGrid_.reset(config.interestRadius);
+    for (const auto& [characterId, player] : players_) {
+        if (player.isInitialized) {
+            playerGrid_.update(characterId, player.posX, player.posY);
+        }
+    }
+    
     req::shared::logInfo("zone", std::string{"Zone config updated: safeSpawn=("} +
         std::to_string(config.safeX) + "," + std::to_string(config.safeY) + "," +
         std::to_string(config.safeZ) + "), safeYaw=" + std::to_string(config.moveSpeed) +
         ", moveSpeed=" + std::to_string(config.moveSpeed) +
         ", autosaveInterval=" + std::to_string(config.autosaveIntervalSec) + "s" +
+        ", tickRate=" + std::to_string(config.tickRateHz) + " Hz" +
         ", broadcastFullState=" + (config.broadcastFullState ? "true" : "false") +
         ", interestRadius=" + std::to_string(config.interestRadius) +
-        ", debugInterest=" + (config.debugInterest ? "true" : "false"));
+        ", debugInterest=" + (config.debugInterest ? "true" : "false") +
+        ", deltaSnapshots=" + (config.deltaSnapshots ? "true" : "false") +
+        ", quantizeState=" + (config.quantizeState ? "true" : "false") +
+        ", npcSleepEnabled=" + (config.npcSleepEnabled ? "true" : "false") +
+        ", npcWakeRadius=" + std::to_string(config.npcWakeRadius) +
+        ", corkWritesDuringTick=" + (config.corkWritesDuringTick ? "true" : "false") +
+        ", ioThreads=" + std::to_string(config.ioThreads) +
+        ", pingInterval=" + std::to_string(config.pingIntervalSec) + "s" +
+        ", udpEnabled=" + (config.udpEnabled ? "true" : "false") +
+        ", netStatsInterval=" + std::to_string(config.netStatsIntervalSec) + "s");
 }
 
 void ZoneServer::removePlayer(std::uint64_t characterId) {
@@ -136,6 +164,10 @@ void ZoneServer::removePlayer(std::uint64_t characterId) {
     req::shared::logInfo("zone", "[REMOVE_PLAYER] Removing from all NPC hate tables");
     removeCharacterFromAllHateTables(player.characterId);
     
+    if (datagramChannel_) {
+        datagramChannel_->removeSession(characterId);
+    }
+    
     // Remove from connection mapping (if connection still exists)
     if (player.connection) {
         auto connIt = connectionToCharacterId_.find(player.connection);
@@ -145,7 +177,11 @@ void ZoneServer::removePlayer(std::uint64_t characterId) {
         }
     }
     
+    unindexCharacterName(player);
+    
     // Remove from players map
+    playerGrid_.remove(characterId);
+    removePlayerMotion(it->second);
     players_.erase(it);
     req::shared::logInfo("zone", "[REMOVE_PLAYER] Removed from players map");
     
@@ -153,4 +189,29 @@ void ZoneServer::removePlayer(std::uint64_t characterId) {
         std::to_string(characterId) + ", remaining_players=" + std::to_string(players_.size()));
 }
 
+void ZoneServer::indexCharacterName(const ZonePlayer& player) {
+    auto [it, inserted] = characterIdByName_.try_emplace(characterNameKey(player.character.name), player.characterId);
+    if (!inserted && it->second != player.characterId) {
+        req::shared::logWarn("zone", std::string{"[NAME_INDEX] Name \""} + player.character.name +
+            "\" already indexed for characterId=" + std::to_string(it->second) +
+            ", now characterId=" + std::to_string(player.characterId));
+        it->second = player.characterId;
+    }
+}
+
+void ZoneServer::unindexCharacterName(const ZonePlayer& player) {
+    auto it = characterIdByName_.find(characterNameKey(player.character.name));
+    if (it != characterIdByName_.end() && it->second == player.characterId) {
+        characterIdByName_.erase(it);
+    }
+}
+
+std::optional<std::uint64_t> ZoneServer::findCharacterIdByName(std::string_view name) const {
+    auto it = characterIdByName_.find(characterNameKey(name));
+    if (it == characterIdByName_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
 } // namespace req::zone
@@ -7,14 +7,12 @@
 #include <cmath>
 #include <algorithm>
 #include <chrono>
+#include <limits>
 
 namespace req::zone {
 
 namespace {
-    // Simulation constants
-    constexpr float TICK_RATE_HZ = 20.0f;                    // 20 ticks per second
-    constexpr auto TICK_INTERVAL_MS = std::chrono::milliseconds(50);  // 50ms per tick
-    constexpr float TICK_DT = 1.0f / TICK_RATE_HZ;           // 0.05 seconds
+    // Simulation constants (tick rate is zoneConfig_.tickRateHz)
     
     // TODO: configurable movement speed (now using zoneConfig_.moveSpeed instead)
     // Old default was 7.0f - now defaults to 70.0f for visible movement
@@ -25,10 +23,54 @@ namespace {
     
     constexpr float MAX_ALLOWED_MOVE_MULTIPLIER = 1.5f;     // slack for network jitter
     constexpr float SUSPICIOUS_MOVE_MULTIPLIER = 5.0f;      // clearly insane movement
+    
+    std::uint32_t toMicros(std::chrono::steady_clock::duration d) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+        return static_cast<std::uint32_t>(std::clamp<std::int64_t>(us, 0, std::numeric_limits<std::uint32_t>::max()));
+    }
+    
+    // Exact percentile of a sample window (reorders 'samples')
+    std::uint32_t percentileOf(std::vector<std::uint32_t>& samples, double p) {
+        if (samples.empty()) {
+            return 0;
+        }
+        auto index = static_cast<std::size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+    
+    std::string formatPercentiles(std::vector<std::uint32_t>& samples) {
+        std::uint32_t maxUs = samples.empty() ? 0 : *std::max_element(samples.begin(), samples.end());
+        return "p50=" + std::to_string(percentileOf(samples, 0.50)) + "us" +
+            " p90=" + std::to_string(percentileOf(samples, 0.90)) + "us" +
+            " p99=" + std::to_string(percentileOf(samples, 0.99)) + "us" +
+            " max=" + std::to_string(maxUs) + "us";
+    }
+}
+
+void ZoneServer::resetTickSchedule() {
+    tickRateHz_ = zoneConfig_.tickRateHz;
+    tickDt_ = 1.0f / tickRateHz_;
+    ticksPerSecond_ = static_cast<std::uint64_t>(std::max(1L, std::lround(tickRateHz_)));
+    tickPeriod_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / static_cast<double>(tickRateHz_)));
+    tickEpoch_ = std::chrono::steady_clock::now();
+    tickIndex_ = 1;
+    nextTickStatsReport_ = tickEpoch_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<float>(zoneConfig_.tickStatsIntervalSec));
+    
+    req::shared::logInfo("zone", std::string{"[TICK] Schedule anchored: rate="} + std::to_string(tickRateHz_) +
+        " Hz, period=" + std::to_string(toMicros(tickPeriod_)) + "us, maxCatchUpTicks=" +
+        std::to_string(zoneConfig_.maxCatchUpTicks));
 }
 
 void ZoneServer::scheduleNextTick() {
-    tickTimer_.expires_after(TICK_INTERVAL_MS);
+    if (tickRateHz_ != zoneConfig_.tickRateHz) {
+        resetTickSchedule();
+    }
+    
+    // Absolute deadline: time spent in the previous tick does not push this one back
+    tickTimer_.expires_at(tickEpoch_ + tickPeriod_ * static_cast<std::int64_t>(tickIndex_));
     tickTimer_.async_wait([this](const boost::system::error_code& ec) {
         onTick(ec);
     });
@@ -45,187 +87,211 @@ void ZoneServer::onTick(const boost::system::error_code& ec) {
         return;
     }
     
+    // Count the deadlines that have passed since we were due. One step per
+    // deadline keeps simulated time equal to wall time; a backlog beyond
+    // maxCatchUpTicks (debugger pause, host stall) is dropped rather than
+    // replayed in one burst.
+    auto wakeTime = std::chrono::steady_clock::now();
+    auto deadline = tickEpoch_ + tickPeriod_ * static_cast<std::int64_t>(tickIndex_);
+    auto wakeLatency = std::max(wakeTime - deadline, std::chrono::steady_clock::duration::zero());
+    std::uint64_t deadlinesDue = 1 + static_cast<std::uint64_t>(wakeLatency / tickPeriod_);
+    std::uint64_t steps = std::min<std::uint64_t>(deadlinesDue, zoneConfig_.maxCatchUpTicks);
+    tickIndex_ += deadlinesDue;
+    
+    ++tickStats_.wakeUps;
+    tickStats_.steps += steps;
+    if (deadlinesDue > 1) {
+        ++tickStats_.lateWakeUps;
+        tickStats_.catchUpSteps += steps - 1;
+        tickStats_.skippedSteps += deadlinesDue - steps;
+    }
+    
+    // Hold all writes produced during this tick so each connection flushes
+    // them in a single gather write afterwards
+    if (zoneConfig_.corkWritesDuringTick) {
+        setConnectionsCorked(true);
+    }
+    
+    // Apply messages/disconnects queued by the I/O threads since the last tick
+    drainInboundEvents();
+    
+    // Character writes that failed on the save queue's thread since the last tick
+    drainCharacterSaveFailures();
+    
     // Update simulation with fixed timestep
-    updateSimulation(TICK_DT);
+    for (std::uint64_t step = 0; step < steps; ++step) {
+        updateSimulation(tickDt_);
+    }
     
     // Broadcast state snapshots to all clients
     broadcastSnapshots();
     
+    if (zoneConfig_.corkWritesDuringTick) {
+        setConnectionsCorked(false);
+    }
+    
+    // Ping players that are due (RTT / clock offset). Sent after uncorking so
+    // the ping leaves when it is stamped instead of after the tick's work.
+    sendLatencyProbes();
+    
+    auto tickEnd = std::chrono::steady_clock::now();
+    if (tickEnd - wakeTime > tickPeriod_) {
+        ++tickStats_.overruns;
+    }
+    if (zoneConfig_.tickStatsIntervalSec > 0.0f) {
+        tickStats_.windowDurationsUs.push_back(toMicros(tickEnd - wakeTime));
+        tickStats_.windowWakeLatenciesUs.push_back(toMicros(wakeLatency));
+        if (tickEnd >= nextTickStatsReport_) {
+            logTickStats();
+            nextTickStatsReport_ = tickEnd + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<float>(zoneConfig_.tickStatsIntervalSec));
+        }
+    }
+    
     // Schedule next tick
     scheduleNextTick();
 }
 
+void ZoneServer::logTickStats() {
+    req::shared::logInfo("zone", std::string{"[TICK] rate="} + std::to_string(tickRateHz_) + " Hz" +
+        ", window=" + std::to_string(tickStats_.windowDurationsUs.size()) + " ticks" +
+        ", duration[" + formatPercentiles(tickStats_.windowDurationsUs) + "]" +
+        ", wakeLatency[" + formatPercentiles(tickStats_.windowWakeLatenciesUs) + "]" +
+        " | total: wakeUps=" + std::to_string(tickStats_.wakeUps) +
+        ", steps=" + std::to_string(tickStats_.steps) +
+        ", late=" + std::to_string(tickStats_.lateWakeUps) +
+        ", catchUpSteps=" + std::to_string(tickStats_.catchUpSteps) +
+        ", skipped=" + std::to_string(tickStats_.skippedSteps) +
+        ", overruns=" + std::to_string(tickStats_.overruns));
+    
+    tickStats_.windowDurationsUs.clear();
+    tickStats_.windowWakeLatenciesUs.clear();
+}
+
 void ZoneServer::updateSimulation(float dt) {
-    // Log simulation update periodically (every 20 ticks = 1 second at 20Hz)
-    static std::uint64_t simLogCounter = 0;
-    bool doDetailedLog = (++simLogCounter % 20 == 0);
+    // Log simulation update periodically (once a second)
+    ++simulationTick_;
+    bool doDetailedLog = (simulationTick_ % ticksPerSecond_ == 0);
     
     // Get configurable move speed from zone config
     const float moveSpeed = zoneConfig_.moveSpeed;
     
-    // Update player physics
-    for (auto& [characterId, player] : players_) {
-        if (!player.isInitialized) {
+    // Update player physics: one vectorized pass over the motion table, then
+    // copy back only the players whose position or velocity changed
+    req::shared::MotionParams motionParams;
+    motionParams.dt = dt;
+    motionParams.moveSpeed = moveSpeed;
+    motionParams.gravity = GRAVITY;
+    motionParams.jumpVelocity = JUMP_VELOCITY;
+    motionParams.groundLevel = GROUND_LEVEL;
+    motionParams.maxAllowedMoveMultiplier = MAX_ALLOWED_MOVE_MULTIPLIER;
+    motionParams.suspiciousMoveMultiplier = SUSPICIOUS_MOVE_MULTIPLIER;
+    req::shared::integrateMotion(playerMotion_, motionParams);
+    
+    const auto& motion = playerMotion_;
+    for (std::size_t slot = 0; slot < motion.size(); ++slot) {
+        std::uint8_t flags = motion.flags[slot];
+        if (flags == 0 && !(doDetailedLog && motion.enabled[slot])) {
             continue;
         }
         
-        // Skip physics updates for dead players
-        if (player.isDead) {
+        std::uint64_t characterId = motion.ids[slot];
+        auto playerIt = players_.find(characterId);
+        if (playerIt == players_.end()) {
             continue;
         }
+        ZonePlayer& player = playerIt->second;
         
-        // Log initial state for debugging
-        if (doDetailedLog) {
-            req::shared::logInfo("zone", std::string{"[Sim] Player "} + std::to_string(characterId) +
-                " BEFORE: pos=(" + std::to_string(player.posX) + "," + std::to_string(player.posY) + "," + std::to_string(player.posZ) + ")" +
-                ", input=(" + std::to_string(player.inputX) + "," + std::to_string(player.inputY) + ")");
+        if (flags & req::shared::MotionFlag::Jumped) {
+            req::shared::logInfo("zone", std::string{"[Sim] Player "} + std::to_string(characterId) + " jumped");
         }
         
-        // Compute 2D movement direction from input
-        float inputLength = std::sqrt(player.inputX * player.inputX + player.inputY * player.inputY);
-        float dirX = player.inputX;
-        float dirY = player.inputY;
-        
-        // Normalize diagonal movement
-        if (inputLength > 1.0f) {
-            dirX /= inputLength;
-            dirY /= inputLength;
-            inputLength = 1.0f;
+        if (flags & req::shared::MotionFlag::SnappedBack) {
+            // Clearly insane movement - snapped back to last valid position
+            float maxAllowedMove = moveSpeed * dt * MAX_ALLOWED_MOVE_MULTIPLIER;
+            req::shared::logWarn("zone", std::string{"Movement suspicious for characterId="} + 
+                std::to_string(characterId) + ", dist=" + std::to_string(motion.moveDist[slot]) + 
+                " (max allowed=" + std::to_string(maxAllowedMove) + "), snapping back to last valid position");
         }
         
-        // Compute desired velocity using configurable move speed
-        player.velX = dirX * moveSpeed;
-        player.velY = dirY * moveSpeed;
+        if (flags & req::shared::MotionFlag::Moved) {
+            player.posX = motion.posX[slot];
+            player.posY = motion.posY[slot];
+            player.posZ = motion.posZ[slot];
+            player.velX = motion.velX[slot];
+            player.velY = motion.velY[slot];
+            player.velZ = motion.velZ[slot];
+            player.lastValidPosX = motion.lastValidX[slot];
+            player.lastValidPosY = motion.lastValidY[slot];
+            player.lastValidPosZ = motion.lastValidZ[slot];
+            playerGrid_.update(characterId, player.posX, player.posY);
+        }
         
-        // Compute expected move distance this frame
-        const float maxMoveDist = moveSpeed * dt;
+        if (flags & req::shared::MotionFlag::Dirty) {
+            player.isDirty = true;
+        }
         
-        // Log velocity computation with move details
-        if (doDetailedLog && (std::abs(player.velX) > 0.01f || std::abs(player.velY) > 0.01f)) {
+        // Log position periodically for debugging
+        if (doDetailedLog) {
             req::shared::logInfo("zone", std::string{"[Sim] Player "} + std::to_string(characterId) +
-                " MOVE: pos=(" + std::to_string(player.posX) + "," + std::to_string(player.posY) + "," + std::to_string(player.posZ) + ")" +
-                ", input=(" + std::to_string(dirX) + "," + std::to_string(dirY) + ")" +
+                " pos=(" + std::to_string(player.posX) + "," + std::to_string(player.posY) + "," + std::to_string(player.posZ) + ")" +
+                ", input=(" + std::to_string(player.inputX) + "," + std::to_string(player.inputY) + ")" +
                 ", moveSpeed=" + std::to_string(moveSpeed) +
                 ", dt=" + std::to_string(dt) +
-                ", moveDist=" + std::to_string(maxMoveDist));
+                ", moved=" + std::to_string(motion.moveDist[slot]) + " units");
         }
-        
-        // Handle vertical movement / gravity
-        bool isOnGround = (player.posZ <= GROUND_LEVEL);
-        
-        if (isOnGround) {
-            // On ground: can jump
-            if (player.isJumpPressed) {
-                player.velZ = JUMP_VELOCITY;
-                req::shared::logInfo("zone", std::string{"[Sim] Player "} + std::to_string(characterId) + " jumped");
-            } else {
-                // Stay on ground
-                player.velZ = 0.0f;
-            }
-        } else {
-            // In air: apply gravity
-            player.velZ += GRAVITY * dt;
+    }
+    
+    // Update NPCs; idle NPCs far from players are updated less often or not
+    // at all (npcSimulationStep). Dead NPCs count down to respawn here, the
+    // living ones are queued for the AI phase.
+    std::size_t npcAiJobCount = 0;
+    for (auto& [npcId, npc] : npcs_) {
+        float npcDt = npcSimulationStep(npc, dt);
+        if (npcDt <= 0.0f) {
+            continue;
         }
-        
-        // Integrate position
-        float newPosX = player.posX + player.velX * dt;
-        float newPosY = player.posY + player.velY * dt;
-        float newPosZ = player.posZ + player.velZ * dt;
-        
-        // Clamp to ground level
-        if (newPosZ <= GROUND_LEVEL) {
-            newPosZ = GROUND_LEVEL;
-            player.velZ = 0.0f;
+        if (npc.isAlive) {
+            if (npcAiJobCount == npcAiJobs_.size()) {
+                npcAiJobs_.emplace_back();
+            }
+            NpcAiJob& job = npcAiJobs_[npcAiJobCount++];
+            job.npc = &npc;
+            job.dt = npcDt;
+            continue;
         }
+        updateNpc(npc, npcDt);
         
-        // Basic anti-cheat / sanity check
-        float dx = newPosX - player.lastValidPosX;
-        float dy = newPosY - player.lastValidPosY;
-        float dz = newPosZ - player.lastValidPosZ;
-        float dist = std::sqrt(dx * dx + dy * dy + dz * dz);
-        
-        float maxAllowedMove = moveSpeed * dt * MAX_ALLOWED_MOVE_MULTIPLIER;
-        float suspiciousThreshold = maxAllowedMove * SUSPICIOUS_MOVE_MULTIPLIER;
-        
-        if (dist > suspiciousThreshold) {
-            // Clearly insane movement - snap back
-            req::shared::logWarn("zone", std::string{"Movement suspicious for characterId="} + 
-                std::to_string(characterId) + ", dist=" + std::to_string(dist) + 
-                " (max allowed=" + std::to_string(maxAllowedMove) + "), snapping back to last valid position");
-            
-            player.posX = player.lastValidPosX;
-            player.posY = player.lastValidPosY;
-            player.posZ = player.lastValidPosZ;
-            player.velX = 0.0f;
-            player.velY = 0.0f;
-            player.velZ = 0.0f;
+        // Keep the NPC grid to alive NPCs so assist queries skip corpses
+        if (npc.isAlive) {
+            npcGrid_.update(npcId, npc.posX, npc.posY);
         } else {
-            // Accept new position
-            player.posX = newPosX;
-            player.posY = newPosY;
-            player.posZ = newPosZ;
-            
-            // Update last valid position
-            player.lastValidPosX = newPosX;
-            player.lastValidPosY = newPosY;
-            player.lastValidPosZ = newPosZ;
-            
-            // Mark as dirty if position changed
-            if (dist > 0.01f) {  // Small threshold to avoid marking on tiny movements
-                player.isDirty = true;
-            }
-            
-            // Log position change
-            if (doDetailedLog) {
-                req::shared::logInfo("zone", std::string{"[Sim] Player "} + std::to_string(characterId) +
-                    " AFTER: pos=(" + std::to_string(player.posX) + "," + std::to_string(player.posY) + "," + std::to_string(player.posZ) + ")" +
-                    ", moved=" + std::to_string(dist) + " units");
-            }
+            npcGrid_.remove(npcId);
         }
     }
     
-    // Update NPCs (AI state machine)
-    for (auto& [npcId, npc] : npcs_) {
-        updateNpc(npc, dt);
+    runNpcAiPhase(npcAiJobCount);
+    for (std::size_t i = 0; i < npcAiJobCount; ++i) {
+        const auto& npc = *npcAiJobs_[i].npc;
+        npcGrid_.update(npc.npcId, npc.posX, npc.posY);
     }
     
-    // Process spawn system (check for spawns ready to spawn)
+    // Spawns, respawns, corpse expiry and periodic checks that are due
     auto now = std::chrono::system_clock::now();
     double currentTime = std::chrono::duration<double>(now.time_since_epoch()).count();
-    processSpawns(dt, currentTime);
-    
-    // DEFENSIVE: Periodic spawn integrity check (every 30 seconds = 600 ticks)
-    static std::uint64_t spawnIntegrityCounter = 0;
-    if (++spawnIntegrityCounter % 600 == 0 && !spawnRecords_.empty()) {
-        int repairCount = 0;
-        for (auto& [spawnId, record] : spawnRecords_) {
-            if (record.state == SpawnState::Alive && record.current_entity_id != 0) {
-                // Verify NPC actually exists
-                auto npcIt = npcs_.find(record.current_entity_id);
-                if (npcIt == npcs_.end()) {
-                    req::shared::logWarn("zone", std::string{"[SPAWN] Integrity check: NPC "} +
-                        std::to_string(record.current_entity_id) + " from spawn " +
-                        std::to_string(spawnId) + " does not exist - repairing spawn record");
-                    record.state = SpawnState::WaitingToSpawn;
-                    record.current_entity_id = 0;
-                    record.next_spawn_time = currentTime + record.respawn_seconds;
-                    repairCount++;
-                }
-            }
-        }
-        
-        if (repairCount > 0) {
-            req::shared::logWarn("zone", std::string{"[SPAWN] Integrity check repaired "} +
-                std::to_string(repairCount) + " spawn record(s)");
-        }
-    }
+    processTimers(currentTime);
     
-    // Periodic NPC debug logging (every 5 seconds at 20Hz = 100 ticks)
-    static std::uint64_t npcLogCounter = 0;
-    if (!npcs_.empty() && ++npcLogCounter % 100 == 0) {
+    // Periodic NPC debug logging (every 5 seconds)
+    if (!npcs_.empty() && ++npcLogCounter_ % (5 * ticksPerSecond_) == 0) {
         // Count NPCs by state
         int idleCount = 0, alertCount = 0, engagedCount = 0, leasingCount = 0, fleeingCount = 0, deadCount = 0;
+        int reducedCount = 0, asleepCount = 0;
         for (const auto& [npcId, npc] : npcs_) {
+            if (npc.activity == req::shared::data::NpcActivity::Reduced) {
+                reducedCount++;
+            } else if (npc.activity == req::shared::data::NpcActivity::Asleep) {
+                asleepCount++;
+            }
             using NpcAiState = req::shared::data::NpcAiState;
             switch (npc.aiState) {
                 case NpcAiState::Idle: idleCount++; break;
@@ -244,16 +310,77 @@ void ZoneServer::updateSimulation(float dt) {
             ", Engaged:" + std::to_string(engagedCount) +
             ", Leashing:" + std::to_string(leasingCount) +
             ", Fleeing:" + std::to_string(fleeingCount) +
-            ", Dead:" + std::to_string(deadCount));
+            ", Dead:" + std::to_string(deadCount) +
+            " | LOD Reduced:" + std::to_string(reducedCount) +
+            ", Asleep:" + std::to_string(asleepCount));
     }
+}
+
+void ZoneServer::scheduleTimer(ZoneTimerKind kind, std::uint64_t id, double dueTime) {
+    timers_.schedule(dueTime, static_cast<std::uint32_t>(kind), id);
+}
+
+void ZoneServer::processTimers(double currentTime) {
+    dueTimers_.clear();
+    timers_.advance(currentTime, dueTimers_);
     
-    // Process corpse decay (check every second = 20 ticks)
-    static std::uint64_t corpseDecayCounter = 0;
-    if (++corpseDecayCounter % 20 == 0 && !corpses_.empty()) {
-        processCorpseDecay();
+    for (const auto& timer : dueTimers_) {
+        switch (static_cast<ZoneTimerKind>(timer.kind)) {
+            case ZoneTimerKind::SpawnDue:
+                processSpawnTimer(static_cast<std::int32_t>(timer.id), currentTime);
+                break;
+            case ZoneTimerKind::CorpseExpiry:
+                expireCorpse(timer.id, currentTime);
+                break;
+            case ZoneTimerKind::SpawnIntegrity:
+                checkSpawnIntegrity(currentTime);
+                break;
+        }
     }
 }
 
+void ZoneServer::syncPlayerMotion(ZonePlayer& player) {
+    if (player.motionSlot == req::shared::MotionTable::NoSlot) {
+        player.motionSlot = playerMotion_.add(player.characterId);
+    }
+    
+    auto slot = player.motionSlot;
+    auto& motion = playerMotion_;
+    motion.posX[slot] = player.posX;
+    motion.posY[slot] = player.posY;
+    motion.posZ[slot] = player.posZ;
+    motion.velX[slot] = player.velX;
+    motion.velY[slot] = player.velY;
+    motion.velZ[slot] = player.velZ;
+    motion.lastValidX[slot] = player.lastValidPosX;
+    motion.lastValidY[slot] = player.lastValidPosY;
+    motion.lastValidZ[slot] = player.lastValidPosZ;
+    motion.inputX[slot] = player.inputX;
+    motion.inputY[slot] = player.inputY;
+    motion.jump[slot] = player.isJumpPressed ? 1 : 0;
+    motion.enabled[slot] = (player.isInitialized && !player.isDead) ? 1 : 0;
+    
+    if (player.isInitialized) {
+        playerGrid_.update(player.characterId, player.posX, player.posY);
+    }
+}
+
+void ZoneServer::removePlayerMotion(ZonePlayer& player) {
+    if (player.motionSlot == req::shared::MotionTable::NoSlot) {
+        return;
+    }
+    
+    // The last row moves into the freed slot; point its owner at the new slot
+    std::uint64_t movedId = playerMotion_.remove(player.motionSlot);
+    if (movedId != 0) {
+        auto movedIt = players_.find(movedId);
+        if (movedIt != players_.end()) {
+            movedIt->second.motionSlot = player.motionSlot;
+        }
+    }
+    player.motionSlot = req::shared::MotionTable::NoSlot;
+}
+
 void ZoneServer::broadcastSnapshots() {
     if (players_.empty()) {
         // No players to broadcast
@@ -261,8 +388,7 @@ void ZoneServer::broadcastSnapshots() {
     }
     
     // Log snapshot building (periodic, not every tick to reduce spam)
-    static std::uint64_t logCounter = 0;
-    bool doDetailedLog = (++logCounter % 20 == 0);  // Log every 20 snapshots (~1 second at 20Hz)
+    bool doDetailedLog = ((snapshotCounter_ + 1) % ticksPerSecond_ == 0);  // Log about once a second
     
     if (doDetailedLog) {
         req::shared::logInfo("zone", std::string{"[Snapshot] Building snapshot "} + 
@@ -303,9 +429,12 @@ void ZoneServer::broadcastSnapshots() {
             }
         }
         
-        // Build payload once
+        // Build frame once per wire format (binary only if some client negotiated it);
+        // every recipient shares the same immutable frame
         std::string payloadStr = req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot);
-        req::shared::net::Connection::ByteArray payloadBytes(payloadStr.begin(), payloadStr.end());
+        auto textFrame = req::shared::net::Connection::makeFrame(req::shared::MessageType::PlayerStateSnapshot, payloadStr);
+        req::shared::net::Connection::SharedFrame binaryFrame;
+        req::shared::net::Connection::SharedFrame quantizedFrame;
         
         // Log the actual payload string
         if (doDetailedLog) {
@@ -328,7 +457,34 @@ void ZoneServer::broadcastSnapshots() {
             }
             
             try {
-                connection->send(req::shared::MessageType::PlayerStateSnapshot, payloadBytes);
+                // Delta clients get the same snapshot encoded against their own baseline
+                auto charIt = connectionToCharacterId_.find(connection);
+                if (charIt != connectionToCharacterId_.end()) {
+                    auto playerIt = players_.find(charIt->second);
+                    if (playerIt != players_.end() &&
+                        (playerIt->second.capabilities & req::shared::protocol::ZoneCapability::DeltaSnapshots)) {
+                        sendDeltaSnapshot(playerIt->second, snapshot);
+                        sentCount++;
+                        continue;
+                    }
+                }
+                
+                const auto* quantization = getQuantization(connection);
+                if (quantization) {
+                    if (!quantizedFrame) {
+                        quantizedFrame = req::shared::net::Connection::makeFrame(req::shared::MessageType::PlayerStateSnapshot,
+                            req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot, req::shared::protocol::WireFormat::Binary, quantization));
+                    }
+                    sendUnreliable(connection, quantizedFrame);
+                } else if (getWireFormat(connection) == req::shared::protocol::WireFormat::Binary) {
+                    if (!binaryFrame) {
+                        binaryFrame = req::shared::net::Connection::makeFrame(req::shared::MessageType::PlayerStateSnapshot,
+                            req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot, req::shared::protocol::WireFormat::Binary));
+                    }
+                    sendUnreliable(connection, binaryFrame);
+                } else {
+                    sendUnreliable(connection, textFrame);
+                }
                 sentCount++;
             } catch (const std::exception& e) {
                 req::shared::logWarn("zone", std::string{"[Snapshot] Failed to send to connection: "} + e.what());
@@ -344,9 +500,24 @@ void ZoneServer::broadcastSnapshots() {
                 (failedCount > 0 ? " (failed: " + std::to_string(failedCount) + ")" : ""));
         }
     } else {
-        // Interest-based filtering: build per-recipient snapshots
+        // Interest-based filtering: build per-recipient snapshots from the
+        // grid cells around each recipient instead of scanning every player
         int totalSent = 0;
         int totalFailed = 0;
+        std::size_t totalIncluded = 0;
+        
+        auto makeEntry = [](const ZonePlayer& p) {
+            req::shared::protocol::PlayerStateEntry entry;
+            entry.characterId = p.characterId;
+            entry.posX = p.posX;
+            entry.posY = p.posY;
+            entry.posZ = p.posZ;
+            entry.velX = p.velX;
+            entry.velY = p.velY;
+            entry.velZ = p.velZ;
+            entry.yawDegrees = p.yawDegrees;
+            return entry;
+        };
         
         for (auto& [recipientCharId, recipientPlayer] : players_) {
             if (!recipientPlayer.isInitialized || !recipientPlayer.connection) {
@@ -362,58 +533,30 @@ void ZoneServer::broadcastSnapshots() {
             req::shared::protocol::PlayerStateSnapshotData snapshot;
             snapshot.snapshotId = snapshotCounter_;
             
-            float recipientX = recipientPlayer.posX;
-            float recipientY = recipientPlayer.posY;
-            float recipientZ = recipientPlayer.posZ;
+            // Always include self
+            snapshot.players.push_back(makeEntry(recipientPlayer));
+            int includedCount = 1;
             
-            int includedCount = 0;
+            // Log self entry
+            if (doDetailedLog) {
+                req::shared::logInfo("zone", std::string{"[Snapshot] For charId="} + std::to_string(recipientCharId) +
+                    " adding SELF: pos=(" + std::to_string(recipientPlayer.posX) + "," + std::to_string(recipientPlayer.posY) + "," + std::to_string(recipientPlayer.posZ) + ")");
+            }
             
-            for (const auto& [otherCharId, otherPlayer] : players_) {
-                if (!otherPlayer.isInitialized) {
-                    continue;
-                }
-                
-                // Always include self
-                if (otherCharId == recipientCharId) {
-                    req::shared::protocol::PlayerStateEntry entry;
-                    entry.characterId = otherPlayer.characterId;
-                    entry.posX = otherPlayer.posX;
-                    entry.posY = otherPlayer.posY;
-                    entry.posZ = otherPlayer.posZ;
-                    entry.velX = otherPlayer.velX;
-                    entry.velY = otherPlayer.velY;
-                    entry.velZ = otherPlayer.velZ;
-                    entry.yawDegrees = otherPlayer.yawDegrees;
-                    snapshot.players.push_back(entry);
-                    includedCount++;
-                    
-                    // Log self entry
-                    if (doDetailedLog) {
-                        req::shared::logInfo("zone", std::string{"[Snapshot] For charId="} + std::to_string(recipientCharId) +
-                            " adding SELF: pos=(" + std::to_string(entry.posX) + "," + std::to_string(entry.posY) + "," + std::to_string(entry.posZ) + ")");
+            // Others within interestRadius on the XY plane
+            playerGrid_.forEachInRadius(recipientPlayer.posX, recipientPlayer.posY, zoneConfig_.interestRadius,
+                [&](std::uint64_t otherCharId, float, float) {
+                    if (otherCharId == recipientCharId) {
+                        return;
                     }
-                    continue;
-                }
-                
-                // Check distance (2D or 3D - using 2D for now: XY plane)
-                float dx = otherPlayer.posX - recipientX;
-                float dy = otherPlayer.posY - recipientY;
-                float distance = std::sqrt(dx * dx + dy * dy);
-                
-                if (distance <= zoneConfig_.interestRadius) {
-                    req::shared::protocol::PlayerStateEntry entry;
-                    entry.characterId = otherPlayer.characterId;
-                    entry.posX = otherPlayer.posX;
-                    entry.posY = otherPlayer.posY;
-                    entry.posZ = otherPlayer.posZ;
-                    entry.velX = otherPlayer.velX;
-                    entry.velY = otherPlayer.velY;
-                    entry.velZ = otherPlayer.velZ;
-                    entry.yawDegrees = otherPlayer.yawDegrees;
-                    snapshot.players.push_back(entry);
+                    auto otherIt = players_.find(otherCharId);
+                    if (otherIt == players_.end() || !otherIt->second.isInitialized) {
+                        return;
+                    }
+                    snapshot.players.push_back(makeEntry(otherIt->second));
                     includedCount++;
-                }
-            }
+                });
+            totalIncluded += static_cast<std::size_t>(includedCount);
             
             // Debug logging (if enabled)
             if (zoneConfig_.debugInterest && doDetailedLog) {
@@ -424,16 +567,29 @@ void ZoneServer::broadcastSnapshots() {
             
             // Build payload and send to this recipient (with error handling)
             try {
-                std::string payloadStr = req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot);
-                req::shared::net::Connection::ByteArray payloadBytes(payloadStr.begin(), payloadStr.end());
+                if (recipientPlayer.capabilities & req::shared::protocol::ZoneCapability::DeltaSnapshots) {
+                    sendDeltaSnapshot(recipientPlayer, snapshot);
+                    totalSent++;
+                    continue;
+                }
+                
+                auto format = req::shared::protocol::wireFormatForCapabilities(recipientPlayer.capabilities);
+                std::string payloadStr = req::shared::protocol::buildPlayerStateSnapshotPayload(snapshot, format,
+                    getQuantization(recipientPlayer));
                 
                 // Log payload for this recipient
                 if (doDetailedLog) {
-                    req::shared::logInfo("zone", std::string{"[Snapshot] For charId="} + std::to_string(recipientCharId) +
-                        " payload: '" + payloadStr + "'");
+                    if (format == req::shared::protocol::WireFormat::Binary) {
+                        req::shared::logInfo("zone", std::string{"[Snapshot] For charId="} + std::to_string(recipientCharId) +
+                            " payload: <binary, " + std::to_string(payloadStr.size()) + " bytes>");
+                    } else {
+                        req::shared::logInfo("zone", std::string{"[Snapshot] For charId="} + std::to_string(recipientCharId) +
+                            " payload: '" + payloadStr + "'");
+                    }
                 }
 
-                recipientPlayer.connection->send(req::shared::MessageType::PlayerStateSnapshot, payloadBytes);
+                sendUnreliable(recipientPlayer.connection,
+                    req::shared::net::Connection::makeFrame(req::shared::MessageType::PlayerStateSnapshot, payloadStr));
                 totalSent++;
             } catch (const std::exception& e) {
                 req::shared::logWarn("zone", std::string{"[Snapshot] Failed to send to charId="} + 
@@ -445,9 +601,56 @@ void ZoneServer::broadcastSnapshots() {
         // Log overall result (periodic)
         if (doDetailedLog) {
             req::shared::logInfo("zone", std::string{"[Snapshot] Finished sending filtered snapshots: "} +
-                std::to_string(totalSent) + " sent, " + std::to_string(totalFailed) + " failed");
+                std::to_string(totalSent) + " sent, " + std::to_string(totalFailed) + " failed" +
+                ", entries=" + std::to_string(totalIncluded) + ", gridCells=" + std::to_string(playerGrid_.cellCount()));
         }
     }
 }
 
+
+void ZoneServer::sendDeltaSnapshot(ZonePlayer& recipient, const req::shared::protocol::PlayerStateSnapshotData& snapshot) {
+    auto& baselines = recipient.snapshotBaselines;
+    
+    const auto* quantization = getQuantization(recipient);
+    std::vector<req::shared::protocol::PlayerStateEntry> state = snapshot.players;
+    std::sort(state.begin(), state.end(), [](const auto& a, const auto& b) {
+        return a.characterId < b.characterId;
+    });
+    if (quantization) {
+        // Baselines hold what the client decoded, so sub-step jitter is not a change
+        for (auto& entry : state) {
+            req::shared::protocol::snapPlayerStateToQuantized(entry, *quantization);
+        }
+    }
+    
+    // Acks only move forward, so anything older than the acked snapshot is dead
+    while (!baselines.sent.empty() && baselines.sent.front().first < baselines.ackedSnapshotId) {
+        baselines.sent.pop_front();
+    }
+    
+    req::shared::protocol::PlayerStateDeltaData delta;
+    delta.snapshotId = snapshot.snapshotId;
+    if (baselines.ackedSnapshotId != 0 && !baselines.sent.empty() &&
+        baselines.sent.front().first == baselines.ackedSnapshotId) {
+        delta.baselineSnapshotId = baselines.ackedSnapshotId;
+        req::shared::protocol::diffPlayerStates(baselines.sent.front().second, state, delta);
+        ++baselines.deltasSent;
+    } else {
+        // No usable baseline: full state, every field of every entry
+        delta.changed.reserve(state.size());
+        for (const auto& entry : state) {
+            delta.changed.push_back(req::shared::protocol::PlayerStateDeltaEntry{ entry, req::shared::protocol::PlayerStateField::All });
+        }
+        ++baselines.fullStatesSent;
+    }
+    
+    sendUnreliable(recipient.connection, req::shared::net::Connection::makeFrame(
+        req::shared::MessageType::PlayerStateDelta, req::shared::protocol::buildPlayerStateDeltaPayload(delta, quantization)));
+    
+    baselines.sent.emplace_back(snapshot.snapshotId, std::move(state));
+    while (baselines.sent.size() > zoneConfig_.snapshotBaselineWindow) {
+        baselines.sent.pop_front();
+    }
+}
+
 } // namespace req::zone
@@ -1,11 +1,13 @@
 #include <exception>
 #include <string>
 #include <cstdlib>
+#include <vector>
 
 #include "../../REQ_Shared/include/req/shared/Logger.h"
 #include "../../REQ_Shared/include/req/shared/Types.h"
 #include "../../REQ_Shared/include/req/shared/Config.h"
 #include "../include/req/zone/ZoneServer.h"
+#include "../include/req/zone/ZoneHost.h"
 
 namespace {
     // Helper to parse command-line arguments in format: --key=value
@@ -16,6 +18,41 @@ namespace {
         }
         return false;
     }
+    
+    // --zones=<id>:<name>:<port>[,<id>:<name>:<port>...]; names may contain spaces
+    bool parseZoneList(const std::string& value, std::vector<req::zone::ZoneHost::ZoneSpec>& outZones) {
+        std::size_t start = 0;
+        while (start <= value.size()) {
+            std::size_t end = value.find(',', start);
+            std::string item = value.substr(start, end == std::string::npos ? std::string::npos : end - start);
+            std::size_t firstColon = item.find(':');
+            std::size_t lastColon = item.rfind(':');
+            if (firstColon == std::string::npos || lastColon == firstColon) {
+                req::shared::logError("Main", std::string{"Invalid --zones entry '"} + item + "' (expected id:name:port)");
+                return false;
+            }
+            try {
+                req::zone::ZoneHost::ZoneSpec spec;
+                spec.zoneId = static_cast<std::uint32_t>(std::stoul(item.substr(0, firstColon)));
+                spec.zoneName = item.substr(firstColon + 1, lastColon - firstColon - 1);
+                unsigned long portValue = std::stoul(item.substr(lastColon + 1));
+                if (portValue == 0 || portValue > 65535) {
+                    req::shared::logError("Main", std::string{"Invalid port in --zones entry '"} + item + "' (must be 1-65535)");
+                    return false;
+                }
+                spec.port = static_cast<std::uint16_t>(portValue);
+                outZones.push_back(spec);
+            } catch (const std::exception& e) {
+                req::shared::logError("Main", std::string{"Failed to parse --zones entry '"} + item + "': " + e.what());
+                return false;
+            }
+            if (end == std::string::npos) {
+                break;
+            }
+            start = end + 1;
+        }
+        return !outZones.empty();
+    }
 }
 
 int main(int argc, char* argv[]) {
@@ -34,6 +71,11 @@ int main(int argc, char* argv[]) {
         bool zoneNameProvided = false;
         bool portProvided = false;
         
+        // Multi-zone hosting: several zones in this process on one thread pool
+        std::vector<req::zone::ZoneHost::ZoneSpec> hostedZones;
+        std::uint32_t hostThreads = 0;
+        std::uint32_t hostAiThreads = 0;  // One NPC AI pool shared by all hosted zones; 0 = none
+        
         // Parse command-line arguments
         req::shared::logInfo("Main", std::string{"Parsing "} + std::to_string(argc - 1) + " command-line argument(s)");
         
@@ -81,6 +123,30 @@ int main(int argc, char* argv[]) {
                     return 1;
                 }
             }
+            else if (parseArgument(arg, "--zones=", value)) {
+                if (!parseZoneList(value, hostedZones)) {
+                    return 1;
+                }
+                req::shared::logInfo("Main", std::string{"  Parsed --zones: "} + std::to_string(hostedZones.size()) + " zone(s)");
+            }
+            else if (parseArgument(arg, "--threads=", value)) {
+                try {
+                    hostThreads = static_cast<std::uint32_t>(std::stoul(value));
+                    req::shared::logInfo("Main", std::string{"  Parsed --threads="} + std::to_string(hostThreads));
+                } catch (const std::exception& e) {
+                    req::shared::logError("Main", std::string{"Failed to parse --threads value '"} + value + "': " + e.what());
+                    return 1;
+                }
+            }
+            else if (parseArgument(arg, "--ai_threads=", value)) {
+                try {
+                    hostAiThreads = static_cast<std::uint32_t>(std::stoul(value));
+                    req::shared::logInfo("Main", std::string{"  Parsed --ai_threads="} + std::to_string(hostAiThreads));
+                } catch (const std::exception& e) {
+                    req::shared::logError("Main", std::string{"Failed to parse --ai_threads value '"} + value + "': " + e.what());
+                    return 1;
+                }
+            }
             else if (parseArgument(arg, "--address=", value)) {
                 address = value;
                 req::shared::logInfo("Main", std::string{"  Parsed --address="} + address);
@@ -91,16 +157,19 @@ int main(int argc, char* argv[]) {
         }
         
         // Log default values used
+        if (!hostedZones.empty() && (zoneIdProvided || zoneNameProvided || portProvided)) {
+            req::shared::logWarn("Main", "--zones given: ignoring --zone_id/--zone_name/--port");
+        }
         if (!worldIdProvided) {
             req::shared::logWarn("Main", std::string{"Using DEFAULT worldId="} + std::to_string(worldId) + " (--world_id not provided)");
         }
-        if (!zoneIdProvided) {
+        if (!zoneIdProvided && hostedZones.empty()) {
             req::shared::logWarn("Main", std::string{"Using DEFAULT zoneId="} + std::to_string(zoneId) + " (--zone_id not provided)");
         }
-        if (!zoneNameProvided) {
+        if (!zoneNameProvided && hostedZones.empty()) {
             req::shared::logWarn("Main", std::string{"Using DEFAULT zoneName=\""} + zoneName + "\" (--zone_name not provided)");
         }
-        if (!portProvided) {
+        if (!portProvided && hostedZones.empty()) {
             req::shared::logWarn("Main", std::string{"Using DEFAULT port="} + std::to_string(port) + " (--port not provided)");
         }
         
@@ -130,6 +199,17 @@ int main(int argc, char* argv[]) {
         // Initialize ZoneServer with characters path
         std::string charactersPath = "data/characters";
         req::shared::logInfo("Main", std::string{"  charactersPath="} + charactersPath);
+        
+        if (!hostedZones.empty()) {
+            req::zone::ZoneHost host(worldId, address, worldRules, xpTable, charactersPath, hostThreads, hostAiThreads);
+            for (const auto& spec : hostedZones) {
+                req::shared::logInfo("Main", std::string{"  hosting zoneId="} + std::to_string(spec.zoneId) +
+                    ", zoneName=\"" + spec.zoneName + "\", port=" + std::to_string(spec.port));
+                host.addZone(spec);
+            }
+            host.run();
+            return 0;
+        }
 
         req::zone::ZoneServer server(worldId, zoneId, zoneName, address, port, 
                                      worldRules, xpTable, charactersPath);